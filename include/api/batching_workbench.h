@@ -0,0 +1,55 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_BATCHING_WORKBENCH_H
+#define TENNIS_API_BATCHING_WORKBENCH_H
+
+#include "common.h"
+#include "tensor.h"
+#include "workbench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Collect concurrent requests into one batch, run workbench once, then scatter outputs back.
+ */
+struct ts_BatchingWorkbench;
+typedef struct ts_BatchingWorkbench ts_BatchingWorkbench;
+
+/**
+ * New batching workbench over workbench.
+ * @param workbench instance of workbench with program setup, do not use it any more after this call
+ * @param max_batch_size max batch in one run, summing dim 0 of each request
+ * @param timeout max microseconds first request waiting for others, since it's enqueued
+ * @return new reference, NULL if failed.
+ * @note @sa ts_free_BatchingWorkbench to free ts_BatchingWorkbench
+ */
+TENNIS_C_API ts_BatchingWorkbench *ts_new_BatchingWorkbench(ts_Workbench *workbench, int32_t max_batch_size, int32_t timeout);
+
+/**
+ * Free batching workbench, waiting requests are run before return.
+ * @param batching instance of batching workbench
+ * Happen nothing if failed.
+ */
+TENNIS_C_API void ts_free_BatchingWorkbench(const ts_BatchingWorkbench *batching);
+
+/**
+ * Run one request, block until outputs ready. Thread safe, concurrent requests are batched.
+ * Inputs with same dtype and same shape except dim 0 are concatenated along dim 0,
+ * after a request run alone shows dim 0 of every output following its batch.
+ * @param batching instance of batching workbench
+ * @param inputs inputs of program
+ * @param len length of inputs
+ * @return new reference, packed tensor of outputs, NULL if failed.
+ * @note use ts_Tensor_field to get each output
+ */
+TENNIS_C_API ts_Tensor *ts_BatchingWorkbench_run(ts_BatchingWorkbench *batching, const ts_Tensor *const *inputs, int32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //TENNIS_API_BATCHING_WORKBENCH_H
@@ -0,0 +1,71 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_CPP_BATCHING_WORKBENCH_H
+#define TENNIS_API_CPP_BATCHING_WORKBENCH_H
+
+#include "../batching_workbench.h"
+
+#include "except.h"
+#include "tensor.h"
+#include "workbench.h"
+
+#include <vector>
+
+namespace ts {
+    namespace api {
+        /**
+         * @see ts_BatchingWorkbench
+         */
+        class BatchingWorkbench {
+        public:
+            using self = BatchingWorkbench;
+            using raw = ts_BatchingWorkbench;
+
+            using shared = std::shared_ptr<self>;
+            using shared_raw = std::shared_ptr<raw>;
+
+            static self NewRef(raw *ptr) { return self(ptr); }
+
+            BatchingWorkbench(const self &) = default;
+
+            BatchingWorkbench &operator=(const self &) = default;
+
+            raw *get_raw() const { return m_impl.get(); }
+
+            bool operator==(std::nullptr_t) const { return get_raw() == nullptr; }
+
+            bool operator!=(std::nullptr_t) const { return get_raw() != nullptr; }
+
+            /**
+             * @see ts_new_BatchingWorkbench
+             */
+            BatchingWorkbench(const Workbench &bench, int max_batch_size, int timeout)
+                    : self(ts_new_BatchingWorkbench(bench.get_raw(), max_batch_size, timeout)) {
+                TS_API_AUTO_CHECK(m_impl != nullptr);
+            }
+
+            /**
+             * @see ts_BatchingWorkbench_run
+             */
+            std::vector<Tensor> run(const std::vector<Tensor> &inputs) {
+                std::vector<const ts_Tensor *> raw_inputs;
+                for (auto &input : inputs) raw_inputs.emplace_back(input.get_raw());
+                auto packed = Tensor::NewRef(ts_BatchingWorkbench_run(
+                        m_impl.get(), raw_inputs.data(), int32_t(raw_inputs.size())));
+                TS_API_AUTO_CHECK(packed != nullptr);
+                return packed.unpack();
+            }
+
+        private:
+            BatchingWorkbench(raw *ptr) : m_impl(pack(ptr)) {}
+
+            static shared_raw pack(raw *ptr) { return shared_raw(ptr, ts_free_BatchingWorkbench); }
+
+            shared_raw m_impl;
+        };
+    }
+}
+
+#endif //TENNIS_API_CPP_BATCHING_WORKBENCH_H
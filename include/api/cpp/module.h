@@ -33,6 +33,7 @@ namespace ts {
 
         static const SerializationFormat BINARY = TS_BINARY;
         static const SerializationFormat TEXT = TS_TEXT;
+        static const SerializationFormat ALIGNED_BINARY = TS_ALIGNED_BINARY;
 
         /**
          * @see ts_Module
@@ -67,6 +68,12 @@ namespace ts {
                 return std::move(loaded);
             }
 
+            static Module LoadMapped(const std::string &path, SerializationFormat format = TS_BINARY) {
+                Module loaded(ts_Module_LoadMapped(path.c_str(), ts_SerializationFormat(format)));
+                TS_API_AUTO_CHECK(loaded.m_impl != nullptr);
+                return std::move(loaded);
+            }
+
             static Module Load(StreamReader &stream, SerializationFormat format = TS_BINARY) {
                 Module loaded(ts_Module_LoadFromStream(&stream, StreamReader::C, ts_SerializationFormat(format)));
                 TS_API_AUTO_CHECK(loaded.m_impl != nullptr);
@@ -66,6 +66,16 @@ namespace ts {
                 return std::move(loaded);
             }
 
+            static Program Load(const std::string &filename, const Device &device, const std::string &options) {
+                Program loaded(ts_Program_Load(filename.c_str(), device.get_raw(), options.c_str()));
+                TS_API_AUTO_CHECK(loaded.m_impl != nullptr);
+                return std::move(loaded);
+            }
+
+            void save(const std::string &filename) const {
+                TS_API_AUTO_CHECK(ts_Program_Save(m_impl.get(), filename.c_str()));
+            }
+
             Program clone() const {
                 Program dolly(ts_Program_clone(m_impl.get()));
                 TS_API_AUTO_CHECK(dolly.m_impl != nullptr);
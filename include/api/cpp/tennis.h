@@ -12,6 +12,8 @@
 #include "module.h"
 #include "image_filter.h"
 #include "workbench.h"
+#include "batching_workbench.h"
+#include "workbench_pool.h"
 #include "intime.h"
 
 #endif //TENNIS_API_CPP_TENNIS_H
@@ -15,6 +15,8 @@
 #include "program.h"
 
 #include <string>
+#include <vector>
+#include <future>
 
 namespace ts {
     namespace api {
@@ -24,6 +26,12 @@ namespace ts {
             LITTLE_CORE = TS_CPU_LITTLE_CORE,
         };
 
+        enum class CpuAffinityPolicy : int32_t {
+            COMPACT = TS_CPU_AFFINITY_COMPACT,
+            SCATTER = TS_CPU_AFFINITY_SCATTER,
+            PHYSICAL = TS_CPU_AFFINITY_PHYSICAL,
+        };
+
         /**
          * @see ts_Workbench
          */
@@ -37,6 +45,13 @@ namespace ts {
 
             static self NewRef(raw *ptr) { return self(ptr); }
 
+            /**
+             * @see ts_Workbench_SetSharedComputePool
+             */
+            static void SetSharedComputePool(int core_budget) {
+                TS_API_AUTO_CHECK(ts_Workbench_SetSharedComputePool(core_budget));
+            }
+
             Workbench(const self &) = default;
 
             Workbench &operator=(const self &) = default;
@@ -104,6 +119,39 @@ namespace ts {
                 TS_API_AUTO_CHECK(ts_Workbench_run(m_impl.get()));
             }
 
+            /**
+             * @see ts_Workbench_run_async
+             * @return future of all outputs
+             */
+            std::future<std::vector<Tensor>> run_async() {
+                auto promise = new std::promise<std::vector<Tensor>>;
+                auto future = promise->get_future();
+                auto callback = [](ts_Workbench *workbench, ts_bool succeed, void *userdata) {
+                    std::unique_ptr<std::promise<std::vector<Tensor>>> promise(
+                            reinterpret_cast<std::promise<std::vector<Tensor>> *>(userdata));
+                    try {
+                        if (!succeed) throw Exception();
+                        auto count = ts_Workbench_output_count(workbench);
+                        std::vector<Tensor> outputs(count);
+                        for (int32_t i = 0; i < count; ++i) {
+                            TS_API_AUTO_CHECK(ts_Workbench_output(workbench, i, outputs[i].get_raw()));
+                        }
+                        promise->set_value(std::move(outputs));
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                };
+                if (!ts_Workbench_run_async(m_impl.get(), callback, promise)) {
+                    delete promise;
+                    throw Exception();
+                }
+                return future;
+            }
+
+            void join_async() {
+                TS_API_AUTO_CHECK(ts_Workbench_join_async(m_impl.get()));
+            }
+
             void output(int slot, ts_Tensor *tensor) {
                 TS_API_AUTO_CHECK(ts_Workbench_output(m_impl.get(), slot, tensor));
             }
@@ -136,6 +184,30 @@ namespace ts {
                 TS_API_AUTO_CHECK(ts_Workbench_set_computing_thread_number(m_impl.get(), number));
             }
 
+            void set_inter_op_thread_number(int number) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_inter_op_thread_number(m_impl.get(), number));
+            }
+
+            void set_spin_wait_time(int microseconds) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_spin_wait_time(m_impl.get(), microseconds));
+            }
+
+            void set_cpu_huge_page(bool enable) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_cpu_huge_page(m_impl.get(), ts_bool(enable)));
+            }
+
+            void set_cpu_affinity(const std::vector<int32_t> &cpu_ids) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_cpu_affinity(m_impl.get(), cpu_ids.data(), int32_t(cpu_ids.size())));
+            }
+
+            void set_cpu_affinity(CpuAffinityPolicy policy) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_cpu_affinity_policy(m_impl.get(), ts_CpuAffinityPolicy(policy)));
+            }
+
+            void set_numa_node(int node, bool replicate = false) {
+                TS_API_AUTO_CHECK(ts_Workbench_set_numa_node(m_impl.get(), node, ts_bool(replicate)));
+            }
+
             void bind_filter(int slot, const ts_ImageFilter *filter) {
                 TS_API_AUTO_CHECK(ts_Workbench_bind_filter(m_impl.get(), slot, filter));
             }
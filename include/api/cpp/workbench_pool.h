@@ -0,0 +1,89 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_CPP_WORKBENCH_POOL_H
+#define TENNIS_API_CPP_WORKBENCH_POOL_H
+
+#include "../workbench_pool.h"
+
+#include "except.h"
+#include "workbench.h"
+
+namespace ts {
+    namespace api {
+        using WorkbenchPoolStatistics = ts_WorkbenchPoolStatistics;
+
+        /**
+         * @see ts_WorkbenchPool
+         */
+        class WorkbenchPool {
+        public:
+            using self = WorkbenchPool;
+            using raw = ts_WorkbenchPool;
+
+            using shared = std::shared_ptr<self>;
+            using shared_raw = std::shared_ptr<raw>;
+
+            static self NewRef(raw *ptr) { return self(ptr); }
+
+            WorkbenchPool(const self &) = default;
+
+            WorkbenchPool &operator=(const self &) = default;
+
+            raw *get_raw() const { return m_impl.get(); }
+
+            bool operator==(std::nullptr_t) const { return get_raw() == nullptr; }
+
+            bool operator!=(std::nullptr_t) const { return get_raw() != nullptr; }
+
+            /**
+             * @see ts_new_WorkbenchPool
+             */
+            WorkbenchPool(const Workbench &bench, int size)
+                    : self(ts_new_WorkbenchPool(bench.get_raw(), size)) {
+                TS_API_AUTO_CHECK(m_impl != nullptr);
+            }
+
+            /**
+             * @see ts_new_WorkbenchPool_v2
+             */
+            WorkbenchPool(const Workbench &bench, int size, const std::vector<int32_t> &nodes, bool replicate = false)
+                    : self(ts_new_WorkbenchPool_v2(bench.get_raw(), size,
+                                                   nodes.data(), int32_t(nodes.size()), ts_bool(replicate))) {
+                TS_API_AUTO_CHECK(m_impl != nullptr);
+            }
+
+            /**
+             * @return workbench returned to pool when released
+             */
+            Workbench checkout() {
+                auto bench = Workbench::NewRef(ts_WorkbenchPool_checkout(m_impl.get()));
+                TS_API_AUTO_CHECK(bench != nullptr);
+                return bench;
+            }
+
+            /**
+             * @return workbench returned to pool when released, nullptr if all checked out
+             */
+            Workbench try_checkout() {
+                return Workbench::NewRef(ts_WorkbenchPool_try_checkout(m_impl.get()));
+            }
+
+            WorkbenchPoolStatistics statistics() const {
+                WorkbenchPoolStatistics stat;
+                TS_API_AUTO_CHECK(ts_WorkbenchPool_statistics(m_impl.get(), &stat));
+                return stat;
+            }
+
+        private:
+            WorkbenchPool(raw *ptr) : m_impl(pack(ptr)) {}
+
+            static shared_raw pack(raw *ptr) { return shared_raw(ptr, ts_free_WorkbenchPool); }
+
+            shared_raw m_impl;
+        };
+    }
+}
+
+#endif //TENNIS_API_CPP_WORKBENCH_POOL_H
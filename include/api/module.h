@@ -25,6 +25,7 @@ typedef struct ts_Module ts_Module;
 enum ts_SerializationFormat {
     TS_BINARY   = 0,    // BINARY file format
     TS_TEXT     = 1,    // TEXT file format
+    TS_ALIGNED_BINARY   = 2,    // BINARY file format with aligned tensor memory
 };
 typedef enum ts_SerializationFormat ts_SerializationFormat;
 
@@ -39,6 +40,16 @@ typedef enum ts_SerializationFormat ts_SerializationFormat;
  */
 TENNIS_C_API ts_Module *ts_Module_Load(const char *filename, ts_SerializationFormat format);
 
+/**
+ * Load module from given filename by memory mapping.
+ * @param filename
+ * @param format @sa ts_SerializationFormat, support TS_BINARY and TS_ALIGNED_BINARY.
+ * @return New reference. Return NULL if failed.
+ * @note call @see ts_free_Module to free ts_Module
+ * @note tensors saved in TS_ALIGNED_BINARY are not copied, they use the mapped file shared with other processes
+ */
+TENNIS_C_API ts_Module *ts_Module_LoadMapped(const char *filename, ts_SerializationFormat format);
+
 /**
  * Load module from given stream.
  * @param obj object pointer pass to reader
@@ -72,12 +72,34 @@ TENNIS_C_API int32_t ts_Program_output_count(ts_Program *program);
  * Option can have:
  * 1. "--float16" using float16 operator
  * 2. "--winograd" using winograd conv2d
+ * 3. "--plan-memory" plan intermediate memory in one arena, for fixed input shapes
  * Reservation options:
  * 1. "--pack" Default ON, pack weights
  * 2. "--filter" Default OFF, filter const values, set values to zero which smaller than FLT_EPSILON
  */
 TENNIS_C_API ts_Program *ts_Program_Compile_v2(const ts_Module *module, const ts_Device *device,
                                                const char *options);
+/**
+ * Save compiled program, keyed by device and compile options.
+ * @param program instance of program
+ * @param filename file to write
+ * @return false if failed
+ * @note saved program can only be loaded by the same version
+ */
+TENNIS_C_API ts_bool ts_Program_Save(const ts_Program *program, const char *filename);
+
+/**
+ * Load program saved by ts_Program_Save, without compiling.
+ * @param filename saved program
+ * @param device @sa ts_Device
+ * @param options compile options, must be same as compiling saved program
+ * @return new reference program, NULL if failed, like not saved with same device and options.
+ * @note Call ts_Workbench_setup_context before load
+ * @note call @see ts_free_Program to free ts_Program
+ * @note file is mapped into memory, constant values on CPU are not copied
+ */
+TENNIS_C_API ts_Program *ts_Program_Load(const char *filename, const ts_Device *device, const char *options);
+
 /**
  * Set operator's param value.
  * @param program instance of program
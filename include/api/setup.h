@@ -17,6 +17,14 @@ extern "C" {
  */
 TENNIS_C_API ts_bool ts_setup();
 
+/**
+ * Back CPU memory not smaller than 2MB with transparent huge pages, in whole process.
+ * @param enable ts_true for using huge pages, default is ts_false
+ * @return ts_true if succeed.
+ * @note only works on linux, CPU memory is always aligned to 64 bytes
+ */
+TENNIS_C_API ts_bool ts_setup_cpu_huge_page(ts_bool enable);
+
 #ifdef __cplusplus
 }
 #endif
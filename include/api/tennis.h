@@ -15,6 +15,8 @@
 #include "module.h"
 #include "image_filter.h"
 #include "workbench.h"
+#include "batching_workbench.h"
+#include "workbench_pool.h"
 #include "intime.h"
 
 #endif //TENNIS_API_TENNIS_H
@@ -80,6 +80,35 @@ TENNIS_C_API ts_bool ts_Workbench_input_by_name(ts_Workbench *workbench, const c
  */
 TENNIS_C_API ts_bool ts_Workbench_run(ts_Workbench *workbench);
 
+/**
+ * Callback of ts_Workbench_run_async, called in executor thread after run.
+ * Outputs can be read by ts_Workbench_output in callback,
+ * if failed, error message can be got by ts_last_error_message in callback.
+ * @param workbench instance of workbench
+ * @param succeed false if run failed
+ * @param userdata userdata given in ts_Workbench_run_async
+ */
+typedef void ts_Workbench_run_callback(ts_Workbench *workbench, ts_bool succeed, void *userdata);
+
+/**
+ * Run network in internal executor with copy of inputs set now, return at once.
+ * @param workbench instance of workbench
+ * @param callback called after run, can be NULL
+ * @param userdata passed to callback
+ * @return false if failed.
+ * @note runs of one workbench are in calling order, inputs of next run can be set at once after calling,
+ *     but do not run, setup or get outputs in other thread before all async runs finished.
+ *     Freeing workbench waits all async runs, it can be freed or joined in callback.
+ */
+TENNIS_C_API ts_bool ts_Workbench_run_async(ts_Workbench *workbench, ts_Workbench_run_callback *callback, void *userdata);
+
+/**
+ * Wait all async runs of workbench finished.
+ * @param workbench instance of workbench
+ * @return false if failed.
+ */
+TENNIS_C_API ts_bool ts_Workbench_join_async(ts_Workbench *workbench);
+
 /**
  * Get output i-th tensor.
  * @param workbench instance of workbench
@@ -106,6 +135,79 @@ TENNIS_C_API ts_bool ts_Workbench_output_by_name(ts_Workbench *workbench, const
  */
 TENNIS_C_API ts_bool ts_Workbench_set_computing_thread_number(ts_Workbench *workbench, int32_t number);
 
+/**
+ * Set number of operators running concurrently
+ * @param workbench instance of workbench
+ * @param number operator number, 0 or 1 means running operators in order
+ * @return false if failed.
+ * @note computing threads are divided between concurrent operators
+ * @note hooked or profiled running still run operators in order
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_inter_op_thread_number(ts_Workbench *workbench, int32_t number);
+
+/**
+ * Set time of working threads busy polling for next task, before blocking
+ * @param workbench instance of workbench
+ * @param microseconds spin time, 0 means blocking at once, which is default
+ * @return false if failed.
+ * @note spinning keeps cores hot between back-to-back operators, at cost of cpu usage
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_spin_wait_time(ts_Workbench *workbench, int32_t microseconds);
+
+/**
+ * Back CPU memory not smaller than 2MB allocated by workbench with transparent huge pages.
+ * @param workbench instance
+ * @param enable ts_true for using huge pages, default is ts_false
+ * @return false if failed.
+ * @note only works on linux, see ts_setup_cpu_huge_page for enabling in whole process
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_cpu_huge_page(ts_Workbench *workbench, ts_bool enable);
+
+enum ts_CpuAffinityPolicy {
+    TS_CPU_AFFINITY_COMPACT = 0,    ///< fill cores of one package first, hyper threads next to each other
+    TS_CPU_AFFINITY_SCATTER = 1,    ///< spread over packages and physical cores first
+    TS_CPU_AFFINITY_PHYSICAL = 2,   ///< one cpu per physical core, hyper threads skipped
+};
+typedef enum ts_CpuAffinityPolicy ts_CpuAffinityPolicy;
+
+/**
+ * Pin computing threads on cpus, i-th thread on cpu_ids[i % len].
+ * @param workbench instance of workbench
+ * @param cpu_ids cpu ids, can be NULL if len is 0
+ * @param len length of cpu_ids, 0 means not pinning
+ * @return false if failed.
+ * @note only work on Linux and Android, setting is ignored on other platforms
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_cpu_affinity(ts_Workbench *workbench, const int32_t *cpu_ids, int32_t len);
+
+/**
+ * Pin computing threads on cpus ordered by policy.
+ * @param workbench instance of workbench
+ * @param policy ts_CpuAffinityPolicy
+ * @return false if failed.
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_cpu_affinity_policy(ts_Workbench *workbench, ts_CpuAffinityPolicy policy);
+
+/**
+ * Pin computing threads on cpus of NUMA node, and place CPU memory allocated in running on node.
+ * @param workbench instance of workbench
+ * @param node NUMA node id, negative means no placement and no cpu affinity
+ * @param replicate ts_true for copying data segment of setup program onto node, instead of sharing it
+ * @return false if failed.
+ * @note only work on Linux, memory allocated before this call is not moved
+ */
+TENNIS_C_API ts_bool ts_Workbench_set_numa_node(ts_Workbench *workbench, int32_t node, ts_bool replicate);
+
+/**
+ * Enable process-wide compute pool shared by all workbenches.
+ * Each run leases cores from pool, so concurrent runs use no more than core_budget threads in total.
+ * Runs are served in arriving order, each gets at most its computing thread number and a fair share of budget.
+ * Leased cores bound the OpenMP threads of each run.
+ * @param core_budget cores shared, negative number means all processors, 0 means disable
+ * @return false if failed.
+ */
+TENNIS_C_API ts_bool ts_Workbench_SetSharedComputePool(int32_t core_budget);
+
 /**
  * Bind filter on i-th input.
  * @param workbench instance of workbench
@@ -201,6 +303,7 @@ TENNIS_C_API ts_bool ts_Workbench_run_hook(ts_Workbench *workbench, const char *
  * Option can have:
  * 1. "--float16" using float16 operator
  * 2. "--winograd" using winograd conv2d
+ * 3. "--plan-memory" plan intermediate memory in one arena, for fixed input shapes
  * Reservation options:
  * 1. "--pack" Default ON, pack weights
  * 2. "--filter" Default OFF, filter const values, set values to zero which smaller than FLT_EPSILON
@@ -217,6 +320,7 @@ TENNIS_C_API ts_Workbench *ts_Workbench_Load_v2(const ts_Module *module, const t
  * Option can have:
  * 1. "--float16" using float16 operator
  * 2. "--winograd" using winograd conv2d
+ * 3. "--plan-memory" plan intermediate memory in one arena, for fixed input shapes
  * Reservation options:
  * 1. "--pack" Default ON, pack weights
  * 2. "--filter" Default OFF, filter const values, set values to zero which smaller than FLT_EPSILON
@@ -240,7 +344,12 @@ TENNIS_C_API ts_bool ts_Workbench_set_operator_param(ts_Workbench *workbench, co
  * @param workbench instance of workbench
  * @return summary string, NULL if failed
  * summary is a json string, like:
- *     {"device": "gpu:0", "thread": 4, "shared": "97.8MB", "memory": {"cpu:0": "32B", "gpu:0": "7.3MB"}}
+ *     {"device": "gpu:0", "thread": 4, "shared": "97.8MB", "memory": {"cpu:0": "32B", "gpu:0": "7.3MB"},
+ *      "statistics": {"gpu:0": {"used": "5.1MB", "free": "2.2MB", "used_blocks": 12, "free_blocks": 4,
+ *          "internal_fragmentation": 0.05, "external_fragmentation": 0.3}, ...}}
+ * statistics is about flow memory, used and free are bytes held by living and reusable blocks,
+ *     internal_fragmentation is rate of used bytes wasted by size class rounding,
+ *     external_fragmentation is rate of held bytes not in use
  */
 TENNIS_C_API const char *ts_Workbench_summary(ts_Workbench *workbench);
 
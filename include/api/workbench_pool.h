@@ -0,0 +1,90 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_WORKBENCH_POOL_H
+#define TENNIS_API_WORKBENCH_POOL_H
+
+#include "common.h"
+#include "workbench.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pool of workbenches running one program in multi threads, sharing thread pools and program's data segment.
+ */
+struct ts_WorkbenchPool;
+typedef struct ts_WorkbenchPool ts_WorkbenchPool;
+
+struct ts_WorkbenchPoolStatistics {
+    int32_t size;           ///< number of workbenches
+    int32_t idle;           ///< number of workbenches not checked out
+    int64_t checkouts;      ///< number of checkout
+    int64_t waits;          ///< number of checkout waiting for returned workbench
+    int64_t wait_time;      ///< microseconds waiting in all checkout
+};
+typedef struct ts_WorkbenchPoolStatistics ts_WorkbenchPoolStatistics;
+
+/**
+ * New pool of workbenches.
+ * @param workbench instance of workbench with program setup, workbenches in pool are forked from it
+ * @param size number of workbenches
+ * @return new reference, NULL if failed.
+ * @note @sa ts_free_WorkbenchPool to free ts_WorkbenchPool
+ * @note workbench is not put in pool, it can still be used by caller
+ */
+TENNIS_C_API ts_WorkbenchPool *ts_new_WorkbenchPool(ts_Workbench *workbench, int32_t size);
+
+/**
+ * New pool of workbenches spread over NUMA nodes, round robin.
+ * Workbenches on one node share thread pools and data segment.
+ * @param workbench instance of workbench with program setup, cloned onto each node then forked, not put in pool
+ * @param size number of workbenches
+ * @param nodes NUMA node ids
+ * @param len length of nodes, 0 means not placing, same as ts_new_WorkbenchPool
+ * @param replicate ts_true for copying data segment onto each node, instead of sharing it across nodes
+ * @return new reference, NULL if failed.
+ * @note @sa ts_free_WorkbenchPool to free ts_WorkbenchPool
+ * @note only work on Linux
+ */
+TENNIS_C_API ts_WorkbenchPool *ts_new_WorkbenchPool_v2(ts_Workbench *workbench, int32_t size,
+                                                       const int32_t *nodes, int32_t len, ts_bool replicate);
+
+/**
+ * Free pool, checked out workbenches are still usable.
+ * @param pool instance of pool
+ * Happen nothing if failed.
+ */
+TENNIS_C_API void ts_free_WorkbenchPool(const ts_WorkbenchPool *pool);
+
+/**
+ * Checkout idle workbench, block until any returned.
+ * @param pool instance of pool
+ * @return new reference, NULL if failed.
+ * @note @sa ts_free_Workbench to return workbench to pool
+ */
+TENNIS_C_API ts_Workbench *ts_WorkbenchPool_checkout(ts_WorkbenchPool *pool);
+
+/**
+ * Checkout idle workbench if any.
+ * @param pool instance of pool
+ * @return new reference, NULL if all workbenches checked out or failed.
+ * @note @sa ts_free_Workbench to return workbench to pool
+ */
+TENNIS_C_API ts_Workbench *ts_WorkbenchPool_try_checkout(ts_WorkbenchPool *pool);
+
+/**
+ * Get statistics of pool.
+ * @param pool instance of pool
+ * @param statistics statistics output
+ * @return false if failed.
+ */
+TENNIS_C_API ts_bool ts_WorkbenchPool_statistics(ts_WorkbenchPool *pool, ts_WorkbenchPoolStatistics *statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //TENNIS_API_WORKBENCH_POOL_H
@@ -39,6 +39,8 @@ namespace ts {
             std::valarray<int> m_dilation4;
 
             bool m_kernel_packed = false;
+
+            Epilogue m_epilogue;
         };
     }
 }
@@ -8,6 +8,7 @@
 #include "backend/common_structure.h"
 #include "core/tensor.h"
 #include "runtime/stack.h"
+#include "base_epilogue.h"
 
 namespace ts {
     namespace base {
@@ -15,6 +16,16 @@ namespace ts {
         public:
             virtual ~Conv2DCore() = default;
 
+            virtual void conv2d(const Tensor &x, const Padding2D &padding, float padding_value,
+                                const Tensor &w, const Stride2D &stride, const Dilation2D &dilation,
+                                Conv2DFormat format, Tensor &out, Stack &stack, bool kernel_packed,
+                                const Epilogue &epilogue) {
+                if (!epilogue.empty()) {
+                    TS_LOG_ERROR << "What a Terrible Failure: dealing fused epilogue without epilogue support." << eject;
+                }
+                conv2d(x, padding, padding_value, w, stride, dilation, format, out, stack, kernel_packed);
+            }
+
             virtual void conv2d(const Tensor &x, const Padding2D &padding, float padding_value,
                                 const Tensor &w, const Stride2D &stride, const Dilation2D &dilation,
                                 Conv2DFormat format, Tensor &out, Stack &stack, bool kernel_packed) {
@@ -76,6 +87,15 @@ namespace ts {
                 m_core = std::make_shared<Core>();
             }
 
+            void conv2d(const Tensor &x, const Padding2D &padding, float padding_value,
+                        const Tensor &w, const Stride2D &stride, const Dilation2D &dilation,
+                        Conv2DFormat format, Tensor &out, Stack &stack, bool kernel_packed,
+                        const Epilogue &epilogue) override {
+                // call by base, in case Core not overriding this
+                static_cast<Conv2DCore &>(*m_core).conv2d(x, padding, padding_value, w, stride, dilation, format, out, stack,
+                                                          kernel_packed, epilogue);
+            }
+
             void conv2d(const Tensor &x, const Padding2D &padding, float padding_value,
                         const Tensor &w, const Stride2D &stride, const Dilation2D &dilation,
                         Conv2DFormat format, Tensor &out, Stack &stack, bool kernel_packed) override {
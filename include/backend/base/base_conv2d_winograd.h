@@ -3,6 +3,7 @@
 
 #include "operator_on_device.h"
 #include "backend/common_structure.h"
+#include "base_epilogue.h"
 
 #include <valarray>
 
@@ -25,16 +26,26 @@ namespace ts{
 
             virtual void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode, const Padding2D &padding, float padding_value,
                 const Tensor &w, Conv2DFormat format, Tensor &out, bool kernel_transformed) = 0;
+
+            virtual void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode, const Padding2D &padding, float padding_value,
+                const Tensor &w, Conv2DFormat format, Tensor &out, bool kernel_transformed, const Epilogue &epilogue) {
+                if (!epilogue.empty()) {
+                    TS_LOG_ERROR << "What a Terrible Failure: dealing fused epilogue without epilogue support." << eject;
+                }
+                conv2d_winograd(x, winograd_mode, padding, padding_value, w, format, out, kernel_transformed);
+            }
 //            virtual void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode,
 //                const Tensor &w, Conv2DFormat format, Tensor &out, Stack &stack) = 0;
 
         private:
             WinogradConv2DMode m_winograd_mode;
+            bool m_winograd_mode_fixed = false;     ///< set by field winograd_mode, or selected by input shape
             Conv2DFormat m_format;
             std::valarray<int> m_padding4x2;
             float m_padding_value;
             bool m_kernel_transformed;
             Tensor m_k_transformed;
+            Epilogue m_epilogue;
         };
     }
 }
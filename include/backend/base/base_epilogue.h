@@ -0,0 +1,66 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_BACKEND_BASE_BASE_EPILOGUE_H
+#define TENSORSTACK_BACKEND_BASE_BASE_EPILOGUE_H
+
+#include "backend/common_structure.h"
+#include "core/tensor.h"
+
+#include <string>
+
+namespace ts {
+    class Operator;
+
+    namespace base {
+        /**
+         * Bias and activation fused into linear operator, applied on each output channel
+         *     while writing back output.
+         * Stored in operator fields: bias, activation, max (relu_max), scale (leaky_relu), slope (prelu).
+         */
+        class TS_DEBUG_API Epilogue {
+        public:
+            using self = Epilogue;
+
+            Tensor bias;        ///< [channels], empty if no bias
+            ActivationType activation = ActivationType::NONE;
+            float max = 0;      ///< upper bound of relu_max
+            float scale = 0;    ///< negative slope of leaky_relu
+            Tensor slope;       ///< [channels] or [1], negative slope of prelu
+
+            bool empty() const;
+
+            /**
+             * @param channels number of output channels
+             * throw exception if bias or slope mismatch channels
+             */
+            void check(const std::string &op, int channels) const;
+
+            /**
+             * declare optional epilogue fields on op
+             */
+            static void Field(Operator &op);
+
+            /**
+             * parse epilogue from op's fields
+             */
+            static self Parse(const Operator &op);
+
+            /**
+             * copy set epilogue fields from one op to another, used by operators wrapping others
+             */
+            static void Copy(const Operator &from, Operator &to);
+
+            /**
+             * @return activation type of op, like relu, NONE if op is not supported
+             */
+            static ActivationType Activation(const std::string &op);
+
+            static std::string Activation(ActivationType type);
+        };
+    }
+}
+
+
+#endif //TENSORSTACK_BACKEND_BASE_BASE_EPILOGUE_H
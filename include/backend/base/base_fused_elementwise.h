@@ -0,0 +1,79 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_BACKEND_BASE_BASE_FUSED_ELEMENTWISE_H
+#define TENSORSTACK_BACKEND_BASE_BASE_FUSED_ELEMENTWISE_H
+
+#include "operator_on_device.h"
+
+namespace ts {
+    namespace base {
+        /**
+         * Evaluate chain of elementwise operators in one pass over output.
+         * Field code is INT32 [steps, 3], each row is (opcode, lhs, rhs) of one step.
+         * Registers [0, inputs) are inputs, step i writes register inputs + i, rhs is -1 for unary step.
+         * The last step is output, inputs are broadcast to output shape like add.
+         */
+        class FusedElementWise : public OperatorOnDevice {
+        public:
+            using self = FusedElementWise;
+            using supper = OperatorOnDevice;
+
+            enum Opcode : int32_t {
+                ADD = 0,
+                SUB = 1,
+                MUL = 2,
+                DIV = 3,
+                MAXIMUM = 4,
+                RELU = 5,
+                SIGMOID = 6,
+                TANH = 7,
+                EXP = 8,
+                SQRT = 9,
+                RSQRT = 10,
+                SQUARE = 11,
+                ABS = 12,
+            };
+
+            class Step {
+            public:
+                int32_t opcode;
+                int32_t lhs;
+                int32_t rhs;
+            };
+
+            FusedElementWise();
+
+            void init() override;
+
+            int run(Stack &stack) override;
+
+            int infer(Stack &stack, std::vector<Tensor::Prototype> &output) override;
+
+            /**
+             * @param inputs all have same dtype and same dims with out,
+             *               each is in output shape, scalar or broadcast to output shape
+             * @param steps steps to run
+             * @param out output
+             */
+            virtual void fused_elementwise(const std::vector<Tensor> &inputs, const std::vector<Step> &steps,
+                                           Tensor &out) = 0;
+
+            /**
+             * @return opcode of op, -1 if op can not be fused
+             */
+            static int Encode(const std::string &op);
+
+            static bool IsUnary(int opcode);
+
+        private:
+            Tensor::Prototype infer_shape(Stack &stack, std::vector<Shape> &input_shapes);
+
+            std::vector<Step> m_steps;
+        };
+    }
+}
+
+
+#endif //TENSORSTACK_BACKEND_BASE_BASE_FUSED_ELEMENTWISE_H
@@ -6,6 +6,7 @@
 #define TENSORSTACK_BACKEND_BASE_BASE_INNER_PROD_H
 
 #include "operator_on_device.h"
+#include "base_epilogue.h"
 
 namespace ts {
     namespace base {
@@ -22,6 +23,22 @@ namespace ts {
 
             int infer(Stack &stack, std::vector<Tensor::Prototype> &output) override;
 
+            /**
+             *
+             * @param lhs
+             * @param rhs
+             * @param out
+             * @param epilogue bias and activation on each column of out
+             * @note all tensor's dtype is same, and all tensors' memory device are give in constructor
+             */
+            virtual void inner_prod(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed,
+                                    const Epilogue &epilogue) {
+                if (!epilogue.empty()) {
+                    TS_LOG_ERROR << "What a Terrible Failure: dealing fused epilogue without epilogue support." << eject;
+                }
+                inner_prod(lhs, rhs, transpose, out, stack, kernel_packed);
+            }
+
             /**
              *
              * @param lhs
@@ -50,6 +67,7 @@ namespace ts {
         private:
             bool m_transpose = false;
             bool m_kernel_packed = false;
+            Epilogue m_epilogue;
         };
     }
 }
@@ -106,6 +106,15 @@ namespace ts {
         NEAREST = 2,
         HARD = 3,
     };
+
+    enum class ActivationType : int {
+        NONE = 0,
+        RELU = 1,
+        RELU_MAX = 2,
+        LEAKY_RELU = 3,
+        PRELU = 4,
+        SIGMOID = 5,
+    };
 }
 
 #endif //TENSORSTACK_BACKEND_COMMON_STRUCTURE_H
@@ -37,6 +37,7 @@ namespace ts {
             TS_DEBUG_API const string &prelu() TS_NOEXCEPT;
             TS_DEBUG_API const string &relu_max() TS_NOEXCEPT;
             TS_DEBUG_API const string &sigmoid() TS_NOEXCEPT;
+            TS_DEBUG_API const string &leaky_relu() TS_NOEXCEPT;
             TS_DEBUG_API const string &softmax() TS_NOEXCEPT;
             TS_DEBUG_API const string &concat() TS_NOEXCEPT;
             TS_DEBUG_API const string &flatten() TS_NOEXCEPT;
@@ -143,6 +144,11 @@ namespace ts {
 
             TS_DEBUG_API const string &conv2d_winograd_v2() TS_NOEXCEPT;
 
+            // 2019-12-18
+            TS_DEBUG_API const string &tanh() TS_NOEXCEPT;
+            TS_DEBUG_API const string &abs() TS_NOEXCEPT;
+            TS_DEBUG_API const string &fused_elementwise() TS_NOEXCEPT;
+
         }
 
         namespace typo {
@@ -230,6 +236,11 @@ namespace ts {
 
         TS_DEBUG_API extern string transpose;
         TS_DEBUG_API extern string kernel_winograd_transformed;
+
+        TS_DEBUG_API extern string bias;
+        TS_DEBUG_API extern string activation;
+
+        TS_DEBUG_API extern string code;
     }
 }
 
@@ -8,6 +8,8 @@
 #include "runtime/instruction.h"
 #include "module/graph.h"
 
+#include <unordered_map>
+
 namespace ts {
 
     class DeviceTensor
@@ -47,6 +49,25 @@ namespace ts {
         std::vector<Instruction::shared> convert_operator_instruction(const Node &node);
 
         static void run_const_nodes(const std::vector<Node> &nodes, std::vector<Node> &const_nodes);
+
+        /**
+         * replace each _shape node, whose input's shape can be inferred from inputs' shape, with const node
+         * @param inputs input nodes, shape declared by #shape, or input_shapes
+         * @param input_shapes shapes of inputs by name, overriding #shape
+         * @param nodes output nodes
+         * @param [out] folded_nodes output nodes after folding
+         * @note compiled program is only valid for the declared input shapes
+         */
+        static void fold_shape_nodes(const std::vector<Node> &inputs,
+                                     const std::unordered_map<std::string, Shape> &input_shapes,
+                                     const std::vector<Node> &nodes, std::vector<Node> &folded_nodes);
+
+        /**
+         * replace each _reshape_v2 with const shape by _reshape
+         * @param nodes output nodes
+         * @param [out] static_nodes output nodes after replacing
+         */
+        static void static_reshape_nodes(const std::vector<Node> &nodes, std::vector<Node> &static_nodes);
     private:
         ComputingDevice m_computing_device;
     };
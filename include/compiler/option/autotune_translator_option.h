@@ -0,0 +1,48 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_AUTOTUNE_TRANSLATOR_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_AUTOTUNE_TRANSLATOR_OPTION_H
+
+#include "translator_option.h"
+#include "core/tensor.h"
+
+#include <unordered_map>
+
+namespace ts {
+    /**
+     * Select convolution algorithm for each NCHW conv2d and conv2d_v2 on CPU by measuring.
+     * Candidates are im2col + gemm (conv2d) and conv2d_winograd in F(2x2,3x3) and F(6x6,3x3).
+     * Input shape is inferred from #shape of parameters, nodes with unknown shape are not tuned.
+     * Fastest algorithm is saved in cache file, keyed by cpu model, threads and layer signature,
+     *     so the same layer is only measured once on one machine.
+     * Opt-in by compiling with --autotune --autotune-cache=<path>, the cache path is required.
+     */
+    class AutotuneTranslatorOption : public TranslatorOption {
+    public:
+        using self = AutotuneTranslatorOption;
+
+        /**
+         * @param cache_path path of tuning cache file, read and appended
+         */
+        explicit AutotuneTranslatorOption(const std::string &cache_path);
+
+        bool translate(const ComputingDevice &device,
+                       const Node node,
+                       Node &translated_node,
+                       const std::string &params,
+                       bool output_flag) const final;
+
+        /**
+         * @return cache path set by --autotune-cache=<path> in params, empty if not set
+         */
+        static std::string CachePath(const std::string &params);
+
+    private:
+        std::string m_cache_path;
+        mutable std::unordered_map<Node, TensorPrototype> m_shapes;
+    };
+}
+
+#endif //TENSORSTACK_COMPILER_OPTION_AUTOTUNE_TRANSLATOR_OPTION_H
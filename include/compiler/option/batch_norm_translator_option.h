@@ -0,0 +1,28 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_BATCH_NORM_TRANSLATOR_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_BATCH_NORM_TRANSLATOR_OPTION_H
+
+#include "translator_option.h"
+
+namespace ts {
+    /**
+     * Fold constant batch_norm, fused_batch_norm, batch_scale and add_bias chain into preceding
+     *     conv2d, conv2d_v2, depthwise_conv2d, depthwise_conv2d_v2 or inner_prod.
+     * The chain becomes conv with scaled kernel, followed by one add_bias.
+     * Registered before other translator options, so kernel is scaled before it is packed.
+     */
+    class BatchNormTranslatorOption : public TranslatorOption {
+    public:
+        bool translate(const ComputingDevice &device,
+                       const Node node,
+                       Node &translated_node,
+                       const std::string &params,
+                       bool output_flag) const final;
+    };
+}
+
+
+#endif //TENSORSTACK_COMPILER_OPTION_BATCH_NORM_TRANSLATOR_OPTION_H
@@ -0,0 +1,27 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_ELEMENTWISE_TRANSLATOR_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_ELEMENTWISE_TRANSLATOR_OPTION_H
+
+#include "translator_option.h"
+
+namespace ts {
+    /**
+     * Fuse chain of elementwise operators (add, sub, mul, div, maximum, relu, sigmoid, tanh,
+     *     exp, sqrt, rsqrt, square, abs) into one _fused_elementwise operator.
+     * Inner nodes of chain must have only one consumer, see base::FusedElementWise.
+     * Opt-in by compiling with --fuse-elementwise.
+     */
+    class ElementWiseTranslatorOption : public TranslatorOption {
+    public:
+        bool translate(const ComputingDevice &device,
+                       const Node node,
+                       Node &translated_node,
+                       const std::string &params,
+                       bool output_flag) const final;
+    };
+}
+
+#endif //TENSORSTACK_COMPILER_OPTION_ELEMENTWISE_TRANSLATOR_OPTION_H
@@ -0,0 +1,24 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_EPILOGUE_ZIPPER_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_EPILOGUE_ZIPPER_OPTION_H
+
+#include "zipper_option.h"
+
+namespace ts {
+    /**
+     * Fuse add_bias and activation (relu, relu_max, leaky_relu, prelu, sigmoid) following
+     *     conv2d, conv2d_v2, conv2d_winograd, conv2d_winograd_v2 or inner_prod on CPU.
+     * The fused node keeps bias and activation in fields, see base::Epilogue,
+     *     and applies them while writing back output.
+     */
+    class EpilogueZipperOption : public ZipperOption {
+    public:
+        bool zip(const ComputingDevice &device, Node node, Node &zipped_node) const final;
+    };
+}
+
+
+#endif //TENSORSTACK_COMPILER_OPTION_EPILOGUE_ZIPPER_OPTION_H
@@ -0,0 +1,24 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_PAD_ZIPPER_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_PAD_ZIPPER_OPTION_H
+
+#include "zipper_option.h"
+
+namespace ts {
+    /**
+     * Fold constant spatial pad into following conv2d, conv2d_v2, depthwise_conv2d, depthwise_conv2d_v2,
+     *     pooling2d or pooling2d_v2, by adding pad to their padding, so the padded copy is never built.
+     * conv takes pad's padding_value, if conv has no padding or the same padding_value.
+     * MAX pooling only takes pad with -inf, AVG pooling only takes pad with 0 if padding_type is WHITE.
+     */
+    class PadZipperOption : public ZipperOption {
+    public:
+        bool zip(const ComputingDevice &device, Node node, Node &zipped_node) const final;
+    };
+}
+
+
+#endif //TENSORSTACK_COMPILER_OPTION_PAD_ZIPPER_OPTION_H
@@ -0,0 +1,23 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_SIMPLIFY_TRANSLATOR_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_SIMPLIFY_TRANSLATOR_OPTION_H
+
+#include "translator_option.h"
+
+namespace ts {
+    /**
+     * Rebuild module with nodes reachable from outputs only, and merge nodes with same op, params and inputs.
+     * Parameter nodes and output nodes are never merged, so inputs and outputs of module are kept.
+     * Opt-in by compiling with --simplify.
+     */
+    class SimplifyTranslatorOption : public TranslatorV2Option {
+    public:
+        Module::shared translate(const ComputingDevice &device,
+                                 Module::shared module) const final;
+    };
+}
+
+#endif //TENSORSTACK_COMPILER_OPTION_SIMPLIFY_TRANSLATOR_OPTION_H
@@ -0,0 +1,28 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_COMPILER_OPTION_TRANSPOSE_TRANSLATOR_OPTION_H
+#define TENSORSTACK_COMPILER_OPTION_TRANSPOSE_TRANSLATOR_OPTION_H
+
+#include "translator_option.h"
+
+namespace ts {
+    /**
+     * Remove data movement of _transpose and _dimshuffle:
+     *     _transpose(_transpose(x)) and _dimshuffle(_dimshuffle(x)) on same dim are composed into one,
+     *     _transpose with identity permute is removed, if rank of its input is known to be size of permute,
+     *     _transpose of const is computed,
+     *     elementwise operators whose inputs are _transpose with same permute (or scalar const)
+     *         compute before _transpose, so the _transpose can meet and cancel the next one.
+     * Only _transpose with permute param is touched.
+     * Opt-in by compiling with --fold-transpose.
+     */
+    class TransposeTranslatorOption : public TranslatorV2Option {
+    public:
+        Module::shared translate(const ComputingDevice &device,
+                                 Module::shared module) const final;
+    };
+}
+
+#endif //TENSORSTACK_COMPILER_OPTION_TRANSPOSE_TRANSLATOR_OPTION_H
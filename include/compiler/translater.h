@@ -10,6 +10,7 @@
 
 namespace ts {
     class TranslatorOption;
+    class TranslatorV2Option;
     /**
      * translate Graph to TGraph
      * translate Graph from other framework to TS support Graph
@@ -33,6 +34,7 @@ namespace ts {
     private:
         ComputingDevice m_device;
         std::vector<const TranslatorOption*> m_options;
+        std::vector<const TranslatorV2Option*> m_options_v2;
         std::string m_params;
     };
 }
@@ -10,6 +10,32 @@
 #include <utils/api.h>
 
 namespace ts {
+    /**
+     * Bytes held by memory controller
+     */
+    struct MemoryStatistics {
+        uint64_t used_size = 0;         ///< requested by living memory
+        uint64_t used_capacity = 0;     ///< capacity of living memory
+        uint64_t free_capacity = 0;     ///< capacity of free memory kept for reusing
+        uint64_t used_blocks = 0;
+        uint64_t free_blocks = 0;
+
+        /**
+         * @return rate of wasted capacity of living memory, caused by rounding to size class
+         */
+        double internal_fragmentation() const {
+            return used_capacity == 0 ? 0.0 : double(used_capacity - used_size) / used_capacity;
+        }
+
+        /**
+         * @return rate of held capacity not in use
+         */
+        double external_fragmentation() const {
+            auto total = used_capacity + free_capacity;
+            return total == 0 ? 0.0 : double(free_capacity) / total;
+        }
+    };
+
     /**
      * MemoryController: Malloc memory and control them
      */
@@ -31,6 +57,12 @@ namespace ts {
          * @return
          */
         virtual uint64_t summary() const { return 0; };
+
+        /**
+         * Get usage and fragmentation of memory under control
+         * @return all zero if not tracked
+         */
+        virtual MemoryStatistics statistics() const { return MemoryStatistics(); }
     };
 
     class TS_DEBUG_API DynamicMemoryController : public MemoryController {
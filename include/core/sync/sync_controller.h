@@ -42,6 +42,11 @@ namespace ts {
         virtual SyncMemoryController::shared clone() const = 0;
 
         virtual std::string summary() const { return "{}"; }
+
+        /**
+         * @return json of memory statistics on each device
+         */
+        virtual std::string statistics() const { return "{}"; }
     };
 
     class TS_DEBUG_API SyncDeviceMemoryController : public SyncMemoryController {
@@ -91,6 +96,15 @@ namespace ts {
             m_sync_controllers.clear(device);
         }
 
+        /**
+         * get base memory controller working on device
+         * @param device memory device
+         * @return base memory controller
+         */
+        std::shared_ptr<BaseMemoryController> controller(const MemoryDevice &device) {
+            return m_sync_controllers.sync(device);
+        }
+
         SyncMemory alloc(size_t size) override {
             return this->alloc(m_device, size);
         }
@@ -132,6 +146,29 @@ namespace ts {
             return oss.str();
         }
 
+        std::string statistics() const override {
+            std::ostringstream oss;
+            oss << "{";
+            bool comma = false;
+            m_sync_controllers.foreach([&](
+                    const typename SyncControllerBlock::key_t &device,
+                    const typename SyncControllerBlock::value_t &controller){
+                if (comma) oss << ", ";
+                else comma = true;
+                auto statistics = controller->statistics();
+                oss << "\"" << device << "\": {"
+                    << "\"used\": \"" << memory_size_string(statistics.used_capacity) << "\""
+                    << ", \"free\": \"" << memory_size_string(statistics.free_capacity) << "\""
+                    << ", \"used_blocks\": " << statistics.used_blocks
+                    << ", \"free_blocks\": " << statistics.free_blocks
+                    << ", \"internal_fragmentation\": " << statistics.internal_fragmentation()
+                    << ", \"external_fragmentation\": " << statistics.external_fragmentation()
+                    << "}";
+            });
+            oss << "}";
+            return oss.str();
+        }
+
     private:
         using SyncControllerBlock = SyncBlock<MemoryDevice, std::shared_ptr<BaseMemoryController>>;
 
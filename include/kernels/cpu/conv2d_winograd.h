@@ -15,6 +15,9 @@ namespace ts {
 
             void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode, const Padding2D &padding, float padding_value,
                 const Tensor &w, Conv2DFormat format, Tensor &out, bool kernel_transformed);
+
+            void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode, const Padding2D &padding, float padding_value,
+                const Tensor &w, Conv2DFormat format, Tensor &out, bool kernel_transformed, const base::Epilogue &epilogue) override;
 //            void conv2d_winograd(const Tensor &x, WinogradConv2DMode winograd_mode,
 //                const Tensor &w, Conv2DFormat format, Tensor &out, Stack &stack);
         };
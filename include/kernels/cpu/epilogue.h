@@ -0,0 +1,141 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_KERNELS_CPU_EPILOGUE_H
+#define TENSORSTACK_KERNELS_CPU_EPILOGUE_H
+
+#include "backend/base/base_epilogue.h"
+#include "core/tensor_builder.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace ts {
+    namespace cpu {
+        /**
+         * apply base::Epilogue on values of type T
+         */
+        template <typename T>
+        class Epilogue {
+        public:
+            using self = Epilogue;
+
+            Epilogue() = default;
+
+            /**
+             * @param epilogue epilogue to apply
+             * @param channel_axis 0 if channel is row index of output matrix, like conv2d,
+             *                     1 if channel is column index, like inner_prod
+             */
+            Epilogue(const base::Epilogue &epilogue, int channel_axis)
+                    : m_channel_axis(channel_axis)
+                    , m_activation(epilogue.activation)
+                    , m_max(T(epilogue.max))
+                    , m_scale(T(epilogue.scale)) {
+                if (!epilogue.bias.empty()) {
+                    m_bias_tensor = tensor::cast(dtypeid<T>::id, epilogue.bias);
+                    m_bias = m_bias_tensor.template data<T>();
+                }
+                if (m_activation == ActivationType::PRELU) {
+                    m_slope_tensor = tensor::cast(dtypeid<T>::id, epilogue.slope);
+                    m_slope = m_slope_tensor.template data<T>();
+                    m_slope_shared = m_slope_tensor.count() == 1;
+                }
+            }
+
+            bool empty() const {
+                return m_bias == nullptr && m_activation == ActivationType::NONE;
+            }
+
+            T operator()(int channel, T value) const {
+                if (m_bias) value += m_bias[channel];
+                switch (m_activation) {
+                    default:
+                        return value;
+                    case ActivationType::RELU:
+                        return value > 0 ? value : T(0);
+                    case ActivationType::RELU_MAX:
+                        return std::min(value > 0 ? value : T(0), m_max);
+                    case ActivationType::LEAKY_RELU:
+                        return value > 0 ? value : value * m_scale;
+                    case ActivationType::PRELU:
+                        return value > 0 ? value : value * m_slope[m_slope_shared ? 0 : channel];
+                    case ActivationType::SIGMOID:
+                        return T(1. / (1. + std::exp(-double(value))));
+                }
+            }
+
+            /**
+             * apply on count values all in channel
+             */
+            void apply(int channel, T *data, int count) const {
+                T bias = m_bias ? m_bias[channel] : T(0);
+                switch (m_activation) {
+                    default:
+                        if (m_bias) for (int i = 0; i < count; ++i) data[i] += bias;
+                        break;
+                    case ActivationType::RELU:
+                        for (int i = 0; i < count; ++i) {
+                            T value = data[i] + bias;
+                            data[i] = value > 0 ? value : T(0);
+                        }
+                        break;
+                    case ActivationType::RELU_MAX:
+                        for (int i = 0; i < count; ++i) {
+                            T value = data[i] + bias;
+                            data[i] = std::min(value > 0 ? value : T(0), m_max);
+                        }
+                        break;
+                    case ActivationType::LEAKY_RELU:
+                        for (int i = 0; i < count; ++i) {
+                            T value = data[i] + bias;
+                            data[i] = value > 0 ? value : value * m_scale;
+                        }
+                        break;
+                    case ActivationType::PRELU: {
+                        T slope = m_slope[m_slope_shared ? 0 : channel];
+                        for (int i = 0; i < count; ++i) {
+                            T value = data[i] + bias;
+                            data[i] = value > 0 ? value : value * slope;
+                        }
+                        break;
+                    }
+                    case ActivationType::SIGMOID:
+                        for (int i = 0; i < count; ++i) {
+                            data[i] = T(1. / (1. + std::exp(-double(data[i] + bias))));
+                        }
+                        break;
+                }
+            }
+
+            /**
+             * apply on rows [row_begin, row_end) of row major matrix C with N columns
+             */
+            void apply(T *C, int ldc, int row_begin, int row_end, int N) const {
+                for (int m = row_begin; m < row_end; ++m) {
+                    T *row = C + m * ldc;
+                    if (m_channel_axis == 0) {
+                        apply(m, row, N);
+                    } else {
+                        for (int n = 0; n < N; ++n) row[n] = (*this)(n, row[n]);
+                    }
+                }
+            }
+
+        private:
+            int m_channel_axis = 0;
+            ActivationType m_activation = ActivationType::NONE;
+            T m_max = 0;
+            T m_scale = 0;
+            Tensor m_bias_tensor;
+            const T *m_bias = nullptr;
+            Tensor m_slope_tensor;
+            const T *m_slope = nullptr;
+            bool m_slope_shared = false;
+        };
+    }
+}
+
+
+#endif //TENSORSTACK_KERNELS_CPU_EPILOGUE_H
@@ -0,0 +1,25 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_KERNELS_CPU_FUSED_ELEMENTWISE_H
+#define TENSORSTACK_KERNELS_CPU_FUSED_ELEMENTWISE_H
+
+#include "backend/base/base_fused_elementwise.h"
+#include "operator_on_cpu.h"
+
+namespace ts {
+    namespace cpu {
+        class FusedElementWise : public OperatorOnCPU<base::FusedElementWise> {
+        public:
+            using self = FusedElementWise;
+            using supper = OperatorOnCPU<base::FusedElementWise>;
+
+            void fused_elementwise(const std::vector<Tensor> &inputs, const std::vector<Step> &steps,
+                                   Tensor &out) override;
+        };
+    }
+}
+
+
+#endif //TENSORSTACK_KERNELS_CPU_FUSED_ELEMENTWISE_H
@@ -13,6 +13,9 @@ namespace ts {
             using supper = OperatorOnCPU<base::InnerProd>;
 
             void inner_prod(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed) override;
+
+            void inner_prod(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed,
+                            const base::Epilogue &epilogue) override;
         };
     }
 }
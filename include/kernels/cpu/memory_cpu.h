@@ -7,10 +7,41 @@
 
 #include "global/hard_allocator.h"
 #include "global/hard_converter.h"
+#include "utils/ctxmgr_lite.h"
 
 namespace ts {
+    /**
+     * Placement of CPU memory allocated in thread binding it
+     */
+    class TS_DEBUG_API CpuMemoryPlacement : public SetupContext<CpuMemoryPlacement> {
+    public:
+        /**
+         * back memory not smaller than 2MB with transparent huge pages
+         */
+        bool huge_page = false;
+        /**
+         * NUMA node memory not smaller than 128KB placed on, negative means no placement
+         */
+        int numa_node = -1;
+    };
+
+    /**
+     * CPU memory is aligned to 64 bytes,
+     *     and memory not smaller than 2MB is backed with transparent huge pages if enabled (only on linux).
+     * Huge pages are used if enabled by cpu_set_huge_page, or by CpuMemoryPlacement binding in allocating thread.
+     * Memory not smaller than 128KB is placed on NUMA node of CpuMemoryPlacement binding in allocating thread.
+     * Resized memory is kept in place if there is room.
+     */
     void *cpu_allocator(int id, size_t new_size, void *mem, size_t mem_size);
 
+    /**
+     * enable huge pages for all CPU memory in process
+     * @param enable true for using huge pages
+     */
+    TS_DEBUG_API void cpu_set_huge_page(bool enable);
+
+    TS_DEBUG_API bool cpu_get_huge_page();
+
     void cpu_converter(int dst_id, void *dst, int src_id, const void *src, size_t size);
 }
 
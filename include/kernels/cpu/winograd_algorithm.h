@@ -6,6 +6,7 @@
 #define TENSORSTACK_KERNELS_CPU_WINOGRAD_ALGORITHM_H
 
 #include "core/tensor.h"
+#include "epilogue.h"
 
 namespace  ts{
     namespace cpu{
@@ -16,27 +17,31 @@ namespace  ts{
 
             static void winograd_f23_transform_and_pack_input(const Tensor& x, int tile_count, Tensor &x_tm);
 
-            static void winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out);
+            static void winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                     const Epilogue<T> *epilogue = nullptr);
 
             static void winograd_f23(const Tensor &x,
                                      const Padding2D &padding,
                                      float padding_value,
                                      const Tensor &kernel,
                                      Tensor &out,
-                                     bool kernel_transformed = true);
+                                     bool kernel_transformed = true,
+                                     const Epilogue<T> *epilogue = nullptr);
 
             static void winograd_f63_transform_and_pack_kernel(const Tensor& kernel, int in_tile_size, Tensor &kernel_tm);
 
             static void winograd_f63_transform_and_pack_input(const Tensor& x, int tile_count, Tensor &x_tm);
 
-            static void winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out);
+            static void winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                     const Epilogue<T> *epilogue = nullptr);
 
             static void winograd_f63(const Tensor &x,
                                      const Padding2D &padding,
                                      float padding_value,
                                      const Tensor &kernel,
                                      Tensor &out,
-                                     bool kernel_transformed = true);
+                                     bool kernel_transformed = true,
+                                     const Epilogue<T> *epilogue = nullptr);
         };
     }
 }
@@ -40,6 +40,36 @@ namespace ts {
 
         uint64_t summary() const override ;
 
+        MemoryStatistics statistics() const override;
+
+    private:
+        class Implement;
+        Declare<Implement> m_impl;
+    };
+
+
+    /**
+     * VatMemoryController with allocating and freeing locked,
+     * used when operators running concurrently
+     */
+    class TS_DEBUG_API LockedVatMemoryController : public MemoryController {
+    public:
+        using self = LockedVatMemoryController;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+        using supper = MemoryController;
+        /**
+         * @param device the memory device
+         */
+        explicit LockedVatMemoryController(const MemoryDevice &device);
+
+        ~LockedVatMemoryController() override;
+
+        Memory alloc(size_t size) override;
+
+        uint64_t summary() const override ;
+
+        MemoryStatistics statistics() const override;
+
     private:
         class Implement;
         Declare<Implement> m_impl;
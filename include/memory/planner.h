@@ -0,0 +1,125 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_MEMORY_PLANNER_H
+#define TENSORSTACK_MEMORY_PLANNER_H
+
+#include <utils/implement.h>
+#include "core/controller.h"
+
+#include <vector>
+
+namespace ts {
+    /**
+     * Static memory plan of one run.
+     * Each allocation, in allocating order, has a fixed offset in one arena.
+     */
+    class TS_DEBUG_API MemoryPlan {
+    public:
+        using self = MemoryPlan;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        /**
+         * lifetime of one allocation, measured in ticks of alloc and free events
+         */
+        class Lifetime {
+        public:
+            size_t size = 0;
+            int64_t alloc = 0;
+            int64_t free = -1;  ///< -1 means memory still alive after run
+        };
+
+        class Block {
+        public:
+            size_t size = 0;
+            size_t offset = 0;
+            /**
+             * earlier blocks reusing the memory of this block,
+             * all of them must be freed before this block allocated
+             */
+            std::vector<int> reused;
+        };
+
+        /**
+         * build plan with liveness of each allocation, using greedy best-fit by size
+         * @param lifetimes lifetimes in allocating order
+         * @param alignment alignment of each block in arena
+         * @return built plan
+         */
+        static shared Build(const std::vector<Lifetime> &lifetimes, size_t alignment = 64);
+
+        size_t arena_size() const { return m_arena_size; }
+
+        size_t count() const { return m_blocks.size(); }
+
+        const Block &block(size_t i) const { return m_blocks[i]; }
+
+        /**
+         * @return sum of all block size, the memory used without plan
+         */
+        size_t total_size() const { return m_total_size; }
+
+    private:
+        std::vector<Block> m_blocks;
+        size_t m_arena_size = 0;
+        size_t m_total_size = 0;
+    };
+
+    /**
+     * Flow memory controller supporting static memory plan.
+     * Works like VatMemoryController, until record or replay called.
+     * In replay mode, each allocation in plan is pointer arithmetic in one arena.
+     * @note not thread safe, the allocating order must be deterministic in one run
+     */
+    class TS_DEBUG_API PlannedMemoryController : public MemoryController {
+    public:
+        using self = PlannedMemoryController;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+        using supper = MemoryController;
+        /**
+         * @param device the memory device
+         */
+        explicit PlannedMemoryController(const MemoryDevice &device);
+
+        ~PlannedMemoryController() override;
+
+        Memory alloc(size_t size) override;
+
+        uint64_t summary() const override;
+
+        /**
+         * @return statistics of vat, with arena of plan counted as one block, used while any planned memory living
+         */
+        MemoryStatistics statistics() const override;
+
+        /**
+         * start recording lifetime of each allocation
+         */
+        void record();
+
+        /**
+         * start replaying plan
+         * @param plan built plan
+         */
+        void replay(MemoryPlan::shared plan);
+
+        /**
+         * stop recording or replaying
+         * @return built plan if recording, or nullptr
+         */
+        MemoryPlan::shared finish();
+
+        /**
+         * @return number of allocations not satisfied by plan, since last replay
+         */
+        size_t missed() const;
+
+    private:
+        class Implement;
+        Declare<Implement> m_impl;
+    };
+}
+
+
+#endif //TENSORSTACK_MEMORY_PLANNER_H
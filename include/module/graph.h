@@ -132,6 +132,11 @@ namespace ts {
             return std::move(out_vector);
         }
 
+        /**
+         * @return true if the graph owning node has been released
+         */
+        bool expired() const { return m_ptr.expired(); }
+
         Node input(int i) const { return inputs()[i]; }
 
         Node input(size_t i) const { return inputs()[i]; }
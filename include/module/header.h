@@ -12,6 +12,22 @@
 #include <cstdint>
 
 #define TS_MODULE_CODE_V1 0x19910929
+/**
+ * V1 with tensor memory aligned, alignment is saved in first 4 bytes of header's data
+ */
+#define TS_MODULE_CODE_V1_ALIGNED 0x19910930
+
+#define TS_MODULE_ALIGNMENT 64
+
+/**
+ * compiled program saved by Program::Save, in aligned format
+ */
+#define TS_PROGRAM_CODE_V1 0x19910931
+
+/**
+ * layout of operators and data segment in saved program, increase it when any of them changed
+ */
+#define TS_PROGRAM_FORMAT_VERSION 1
 
 namespace ts {
     class TS_DEBUG_API Header : public Serializable {
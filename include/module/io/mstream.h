@@ -0,0 +1,70 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_MODULE_IO_MSTREAM_H
+#define TENSORSTACK_MODULE_IO_MSTREAM_H
+
+#include "stream.h"
+
+#include <memory>
+
+namespace ts {
+    class MappedFile;
+
+    /**
+     * Read file by memory mapping, the mapping is copy-on-write and shared by page cache.
+     * Memory given by view keeps mapping alive, after reader closed.
+     */
+    class TS_DEBUG_API MappedStreamReader : public StreamReader {
+    public:
+        using self = MappedStreamReader;
+        using supper = StreamReader;
+
+        MappedStreamReader(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        MappedStreamReader();
+
+        explicit MappedStreamReader(const std::string &path);
+
+        void open(const std::string &path);
+
+        bool is_open() const;
+
+        void close();
+
+        size_t read(void *buffer, size_t size) final;
+
+        /**
+         * skip next size bytes
+         * @return skipped size
+         */
+        size_t skip(size_t size);
+
+        /**
+         * get next size bytes without copy
+         * @param size size in bytes
+         * @param [out] memory CPU memory in mapping, keeping mapping alive
+         * @return false if there is no enough bytes
+         */
+        bool view(size_t size, Memory &memory);
+
+        size_t position() const { return m_position; }
+
+        size_t size() const;
+
+        /**
+         * @param data pointer
+         * @return true if data is in any alive mapping
+         */
+        static bool Mapped(const void *data);
+
+    private:
+        std::shared_ptr<MappedFile> m_file;
+        size_t m_position = 0;
+    };
+}
+
+#endif //TENSORSTACK_MODULE_IO_MSTREAM_H
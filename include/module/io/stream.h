@@ -32,6 +32,90 @@ namespace ts {
         using self = Stream;
     };
 
+    class Memory;
+
+    /**
+     * Reader counting position from beginning of module, used to skip padding of aligned memory
+     */
+    class TS_DEBUG_API AlignedStreamReader : public StreamReader {
+    public:
+        using self = AlignedStreamReader;
+        using supper = StreamReader;
+
+        AlignedStreamReader(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        /**
+         * @param stream base stream
+         * @param alignment alignment in bytes
+         * @param position position of base stream
+         */
+        AlignedStreamReader(StreamReader &stream, size_t alignment, size_t position = 0);
+
+        size_t read(void *buffer, size_t size) final;
+
+        /**
+         * skip padding to next aligned position
+         * @return skipped size
+         */
+        size_t align();
+
+        /**
+         * get next size bytes without copy, only if base stream is MappedStreamReader
+         * @param size size in bytes
+         * @param [out] memory read-only view of base stream
+         * @return false if nothing read
+         */
+        bool view(size_t size, Memory &memory);
+
+        size_t alignment() const { return m_alignment; }
+
+        size_t position() const { return m_position; }
+
+    private:
+        StreamReader &m_stream;
+        size_t m_alignment;
+        size_t m_position;
+    };
+
+    /**
+     * Writer counting position from beginning of module, used to write padding of aligned memory
+     */
+    class TS_DEBUG_API AlignedStreamWriter : public StreamWriter {
+    public:
+        using self = AlignedStreamWriter;
+        using supper = StreamWriter;
+
+        AlignedStreamWriter(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        /**
+         * @param stream base stream
+         * @param alignment alignment in bytes
+         * @param position position of base stream
+         */
+        AlignedStreamWriter(StreamWriter &stream, size_t alignment, size_t position = 0);
+
+        size_t write(const void *buffer, size_t size) final;
+
+        /**
+         * write zero padding to next aligned position
+         * @return written size
+         */
+        size_t align();
+
+        size_t alignment() const { return m_alignment; }
+
+        size_t position() const { return m_position; }
+
+    private:
+        StreamWriter &m_stream;
+        size_t m_alignment;
+        size_t m_position;
+    };
+
     namespace binio {
         template<typename T>
         size_t read(StreamReader &stream, T &buffer) {
@@ -35,6 +35,8 @@ namespace ts {
 
         const Node &output(size_t i) const { return m_outputs[i]; }
 
+        const std::vector<Graph> &graphs() const { return m_graphs; }
+
         void clear();
 
         void sort_inputs(const std::vector<Node> &inputs);
@@ -50,11 +52,21 @@ namespace ts {
         enum SerializationFormat {
             BINARY,
             DESCRIPTION,
+            ALIGNED_BINARY,     ///< BINARY with tensor memory aligned, loaded without copy by LoadMapped
         };
 
         static Module::shared Load(StreamReader &stream, SerializationFormat format = BINARY);
         static Module::shared Load(const std::string &filename, SerializationFormat format = BINARY);
 
+        /**
+         * Load module by mapping file into memory.
+         * Tensors saved in ALIGNED_BINARY are views of the mapping, shared by processes loading the same file.
+         * @param filename module file
+         * @param format BINARY or ALIGNED_BINARY, both formats can be loaded
+         * @return loaded module
+         */
+        static Module::shared LoadMapped(const std::string &filename, SerializationFormat format = BINARY);
+
         static void Save(StreamWriter &stream, Module::shared module, SerializationFormat format = BINARY);
         static void Save(const std::string &filename, Module::shared module, SerializationFormat format = BINARY);
 
@@ -0,0 +1,60 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_BATCHING_WORKBENCH_H
+#define TENSORSTACK_RUNTIME_BATCHING_WORKBENCH_H
+
+#include "workbench.h"
+
+#include "utils/implement.h"
+
+namespace ts {
+    /**
+     * Collect concurrent requests into one batch, run workbench once, then scatter outputs back.
+     * Inputs of requests are concatenated along dim 0, outputs are split along dim 0 by each request's batch.
+     * Requests can be batched only if their inputs have same dtype and same shape except dim 0.
+     * Requests are run one by one until a request run alone shows dim 0 of every output equals its batch,
+     *     and never batched again once any run shows otherwise.
+     * If batched outputs can not be split, or batched run failed, requests are run one by one.
+     */
+    class TS_DEBUG_API BatchingWorkbench {
+    public:
+        using self = BatchingWorkbench;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        /**
+         * @param bench workbench with program setup, owned by batching workbench since now
+         * @param max_batch_size max number of batch in one run, summing dim 0 of each request
+         * @param timeout max microseconds first request waiting for others, since it's enqueued
+         */
+        BatchingWorkbench(Workbench::shared bench, int max_batch_size, int timeout);
+
+        ~BatchingWorkbench();
+
+        BatchingWorkbench(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        /**
+         * run one request, block until outputs ready
+         * @param inputs inputs of program, each with dim 0 as batch
+         * @return outputs of program
+         * @note thread safe, concurrent calls are batched together
+         */
+        std::vector<Tensor> run(const std::vector<Tensor> &inputs);
+
+        int max_batch_size() const;
+
+        int timeout() const;
+
+        Workbench::shared workbench() const;
+
+    private:
+        class Implement;
+        Declare<Implement> m_impl;
+    };
+}
+
+
+#endif //TENSORSTACK_RUNTIME_BATCHING_WORKBENCH_H
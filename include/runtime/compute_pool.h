@@ -0,0 +1,83 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_COMPUTE_POOL_H
+#define TENSORSTACK_RUNTIME_COMPUTE_POOL_H
+
+#include "inside/thread_pool.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace ts {
+    /**
+     * Process-wide computing cores shared by all workbenches.
+     * Each run leases cores before running and gives them back after, so concurrent runs never use
+     *     more threads than budget. Runs are served in arriving order, each gets a fair share of budget.
+     * Leased cores bound the computing thread number of the run, which sets OpenMP threads of operators.
+     * @note The shared thread pool is only used by TS_PARALLEL_* blocks, which are compiled out when
+     *     TS_DISABLE_PARALLEL is defined, as in default build.
+     */
+    class TS_DEBUG_API ComputePool {
+    public:
+        using self = ComputePool;
+        using shared = std::shared_ptr<self>;
+
+        /**
+         * @param core_budget number of cores all runs share, at least 1
+         */
+        explicit ComputePool(int core_budget);
+
+        ComputePool(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        int budget() const { return m_budget; }
+
+        /**
+         * @return thread pool of budget size, shared by all runs
+         */
+        ThreadPool::shared thread_pool() const { return m_thread_pool; }
+
+        /**
+         * lease cores, block until it's calling thread's turn and any core is free
+         * @param cores number of cores wanted
+         * @return number of cores leased, in [1, cores], no more than fair share of budget
+         */
+        int acquire(int cores);
+
+        /**
+         * give back cores leased by acquire
+         * @param cores return value of acquire
+         */
+        void release(int cores);
+
+        /**
+         * enable or disable shared compute pool
+         * @param core_budget cores shared, negative number means all processors, 0 means disable
+         * @note runs already leased keep the old pool until finished
+         */
+        static void Setup(int core_budget);
+
+        /**
+         * @return shared compute pool, nullptr if not enabled
+         */
+        static shared Global();
+
+    private:
+        int m_budget;
+        ThreadPool::shared m_thread_pool;
+
+        std::mutex m_mutex;
+        std::condition_variable m_cond;
+        int m_available;
+        int m_demand = 0;           ///< runs holding or waiting cores
+        uint64_t m_next_ticket = 0;
+        uint64_t m_serving = 0;
+    };
+}
+
+
+#endif //TENSORSTACK_RUNTIME_COMPUTE_POOL_H
@@ -0,0 +1,86 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_CONCAT_BUFFER_H
+#define TENSORSTACK_RUNTIME_CONCAT_BUFFER_H
+
+#include "stack.h"
+
+#include <mutex>
+#include <vector>
+
+namespace ts {
+    /**
+     * Output buffer of concat, shared with the producers of concat's inputs.
+     * Each producer writes its output into one slice of buffer, so concat only takes the buffer.
+     * Layout of slices is recorded by the last concat which copied its inputs,
+     *     only if all dims before concat dim are 1, where each slice is contiguous.
+     * @note concat copies inputs as before, if any input is not in its slice.
+     *     If inputs keep the recorded layout but are not written into slices,
+     *     the producers do not push their outputs into the preset slot, so the buffer stops being allocated.
+     */
+    class TS_DEBUG_API ConcatBuffer {
+    public:
+        using self = ConcatBuffer;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        /**
+         * @param dim concat dim, negative means counting from last dim
+         */
+        explicit ConcatBuffer(int dim);
+
+        int dim() const { return m_dim; }
+
+        /**
+         * @return true if layout of slices is recorded, and producers write into slices
+         */
+        bool ready() const;
+
+        /**
+         * get slice of buffer for input i, buffer is allocated on stack at first call of each run
+         * @param stack stack allocating buffer
+         * @param i index of concat input
+         * @param [out] slice slice of buffer, keeping buffer alive
+         * @return false if there is no recorded layout
+         */
+        bool slice(Stack &stack, int i, Memory &slice);
+
+        /**
+         * take buffer as output, if each input is in its slice.
+         * buffer is disabled if inputs keep recorded layout but are not in slices
+         * @param stack stack with inputs of concat on base
+         * @param nargs number of inputs
+         * @param [out] output buffer
+         * @return false if concat need copy inputs
+         */
+        bool take(const Stack &stack, int nargs, Tensor &output);
+
+        /**
+         * record layout of inputs for next run, after concat copied its inputs
+         * @param stack stack with inputs of concat on base
+         * @param nargs number of inputs
+         */
+        void record(const Stack &stack, int nargs);
+
+        /**
+         * @return new buffer with same dim and layout, but not sharing buffer
+         */
+        shared clone() const;
+
+    private:
+        int m_dim;
+
+        mutable std::mutex m_mutex;
+        bool m_ready = false;
+        bool m_disabled = false;        ///< producers do not write into slices
+        MemoryDevice m_device;
+        Tensor::Prototype m_output;
+        std::vector<Tensor::Prototype> m_inputs;
+        std::vector<size_t> m_offsets;  ///< offset in bytes of each input
+
+        Tensor m_buffer;                ///< allocated in this run, taken by concat
+    };
+}
+
+#endif //TENSORSTACK_RUNTIME_CONCAT_BUFFER_H
@@ -0,0 +1,74 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_DATAFLOW_H
+#define TENSORSTACK_RUNTIME_DATAFLOW_H
+
+#include "instruction.h"
+
+#include <vector>
+
+namespace ts {
+    class Program;
+
+    /**
+     * Dataflow graph of program, built by simulating stack over instructions.
+     * Each value is one tensor on stack, each node is one instruction consuming values and producing one value.
+     */
+    class TS_DEBUG_API Dataflow {
+    public:
+        using self = Dataflow;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        class Value {
+        public:
+            enum Kind {
+                ARGUMENT,   ///< index is input slot
+                DATA,       ///< index is data segment index
+                RESULT,     ///< index is node index
+            };
+
+            Kind kind = RESULT;
+            int index = 0;
+            /**
+             * number of uses, by nodes' inputs and program outputs
+             */
+            int uses = 0;
+        };
+
+        class Node {
+        public:
+            StackInstruction::shared instruction;
+            std::vector<int> inputs;    ///< values, in pushing order
+            int output = -1;            ///< value
+            std::vector<int> next;      ///< nodes using output, one for each use
+            int depends = 0;            ///< number of inputs produced by nodes
+            bool view = false;          ///< output is view of inputs, see OperatorInstruction::is_view
+        };
+
+        /**
+         * analyse program
+         * @param program compiled program
+         * @return dataflow graph, nullptr if program has instructions can not be analysed
+         */
+        static shared Analyse(const Program &program);
+
+        const std::vector<Value> &values() const { return m_values; }
+
+        const std::vector<Node> &nodes() const { return m_nodes; }
+
+        /**
+         * @return values on stack after program run
+         */
+        const std::vector<int> &outputs() const { return m_outputs; }
+
+    private:
+        std::vector<Value> m_values;
+        std::vector<Node> m_nodes;
+        std::vector<int> m_outputs;
+    };
+}
+
+
+#endif //TENSORSTACK_RUNTIME_DATAFLOW_H
@@ -26,17 +26,49 @@ namespace ts {
         return nullptr;
     }
 
+    /**
+     * chunks of one parallel loop, claimed by threads one by one,
+     * so faster thread takes more chunks, instead of waiting stragglers.
+     */
+    class ParallelChunks {
+    public:
+        using self = ParallelChunks;
+        using shared = std::shared_ptr<self>;
+
+        std::function<void(int, int, int)> range_solver;
+        std::vector<Range> chunks;
+        std::atomic<int> next{0};
+
+        void operator()(int signet) {
+            auto size = int(chunks.size());
+            while (true) {
+                auto i = next.fetch_add(1);
+                if (i >= size) break;
+                range_solver(signet, chunks[i].first, chunks[i].second);
+            }
+        }
+    };
+
+    /**
+     * number of chunks each thread split in parallel loop
+     */
+    static const int TS_PARALLEL_CHUNKS_PER_THREAD = 4;
+
     inline void parallel_run(const std::function<void(int, int, int)> &range_solver, int begin, int end, bool joinable = true) {
         auto parallel_gun = ts::try_parallel(end - begin);
         if (parallel_gun) {
-            auto parallel_ranges = ts::split_bins(begin, end, int(parallel_gun->size()));
-            for (auto &parallel_range : parallel_ranges) {
-                parallel_gun->run([range_solver, parallel_range](int signet){
-                    range_solver(signet, parallel_range.first, parallel_range.second);
-                });
-            }
+            auto size = int(parallel_gun->size());
+            auto parallel_chunks = std::make_shared<ParallelChunks>();
+            parallel_chunks->range_solver = range_solver;
+            parallel_chunks->chunks = ts::split_bins(begin, end, size * TS_PARALLEL_CHUNKS_PER_THREAD);
+            auto tasks = std::min(size, int(parallel_chunks->chunks.size()));
+            auto task = [parallel_chunks](int signet) { (*parallel_chunks)(signet); };
             if (joinable) {
-                parallel_gun->join();
+                ThreadPool::Group group;
+                for (int i = 0; i < tasks; ++i) parallel_gun->run(group, task);
+                parallel_gun->join(group);
+            } else {
+                for (int i = 0; i < tasks; ++i) parallel_gun->run(task);
             }
         } else {
             range_solver(0, begin, end);
@@ -44,20 +76,9 @@ namespace ts {
     }
 
     inline void parallel_range(const std::function<void(int, const Range &)> &range_solver, int begin, int end, bool joinable = true) {
-        auto parallel_gun = ts::try_parallel(end - begin);
-        if (parallel_gun) {
-            auto parallel_ranges = ts::split_bins(begin, end, int(parallel_gun->size()));
-            for (auto &parallel_range : parallel_ranges) {
-                parallel_gun->run([range_solver, parallel_range](int signet){
-                    range_solver(signet, parallel_range);
-                });
-            }
-            if (joinable) {
-                parallel_gun->join();
-            }
-        } else {
-            range_solver(0, Range(begin, end));
-        }
+        parallel_run([range_solver](int signet, int range_begin, int range_end) {
+            range_solver(signet, Range(range_begin, range_end));
+        }, begin, end, joinable);
     }
 
     inline void parallel_sync() {
@@ -78,7 +99,7 @@ namespace ts {
  * @param var_loop_value loop value name
  * @param var_loop_begin loop begin value
  * @param var_loop_end loop end value
- * @note the TS_PARALLEL_XXX block do NOT support nest
+ * @note the TS_PARALLEL_XXX block support nest, the loop is split into chunks claimed by free threads
  * @note The input parameters over 3 are the closure value in parallel run
  * Usage:
  * ```
@@ -120,7 +141,7 @@ namespace ts {
  * @param var_range_value range parallel value name, is type of Range
  * @param var_range_begin range parallel begin value
  * @param var_rnage_end range parallel end value
- * @note the TS_PARALLEL_XXX block do NOT support nest
+ * @note the TS_PARALLEL_XXX block support nest, the range is split into chunks claimed by free threads
  * @note The input parameters over 3 are the closure value in parallel run
  * Usage:
  * ```
@@ -13,62 +13,48 @@
 #include <vector>
 #include <deque>
 #include <memory>
+#include <exception>
 
 #include <utils/api.h>
+#include <utils/implement.h>
 #include "utils/ctxmgr_lite.h"
 
 namespace ts {
-    class TS_DEBUG_API Thread {
+    /**
+     * @brief The ThreadPool class, work-stealing thread pool
+     * Each thread has its own lock-free task deque, idle threads steal tasks from others.
+     * Tasks can run nested tasks in the same pool,
+     *     thread in pool waiting for tasks keeps running other tasks instead of blocking.
+     */
+    class TS_DEBUG_API ThreadPool : public SetupContext<ThreadPool> {
     public:
-        using self = Thread;
+        using self = ThreadPool;
         using shared = std::shared_ptr<self>;
 
         using task_type = std::function<void(int)>;
         using after_task_type = std::function<void(int)>;
 
-        Thread();
-
-        ~Thread();
-
-        Thread(const Thread &) = delete;
-
-        const Thread &operator=(const Thread &) = delete;
-
         /**
-         * @brief run Asynchronous build and run task, first calls the task, then calls the after_task.
-         * @param signet the index to call `task(signet)` and `after_task(signet)`
-         * @param task the function call in thread
-         * @param after_task call it after task called
+         * @brief Group of tasks waited together
          */
-        void run(int signet, const task_type &task, const after_task_type &after_task = nullptr);
+        class TS_DEBUG_API Group {
+        public:
+            using self = Group;
 
-        bool busy();
+            Group() = default;
 
-        void join();
+            Group(const Group &) = delete;
 
-    private:
-
-        void operating();
-
-        std::mutex task_mutex;              ///< mutex control each fire
-        std::condition_variable task_cond;  ///< condition to tell if fire finished
-        std::atomic<bool> is_running;       ///< object only work when dry is true
-
-        int signet;                         ///< the argument to call `bullet(signet)` and `shell(signet)`
-        task_type task = nullptr;          ///< main function call in thread
-        after_task_type after_task = nullptr;   ///< side function call after `bullet` called
+            const Group &operator=(const Group &) = delete;
 
-        std::thread core;                   ///< working thread
+        private:
+            friend class ThreadPool;
 
-    };
-
-    /**
- * @brief The ThreadPool class the thread pool
- */
-    class TS_DEBUG_API ThreadPool : public SetupContext<ThreadPool> {
-    public:
-        using self = ThreadPool;
-        using shared = std::shared_ptr<self>;
+            std::mutex mutex;
+            std::condition_variable cond;
+            std::atomic<int> pending{0};
+            std::exception_ptr exception;
+        };
 
         /**
          * @brief Shotgun
@@ -83,25 +69,38 @@ namespace ts {
         const ThreadPool &operator=(const ThreadPool &) = delete;
 
         /**
-         * @brief run Find ready thread, build task and run.
-         * @param task the task ready to run
-         * @return The running thread
+         * @brief run Push task to run in any ready thread.
+         * @param task the task ready to run, called with index of running thread
          */
-        Thread *run(const Thread::task_type &task);
+        void run(const task_type &task);
 
         /**
-         * @brief run Find ready thread, build task and run.
+         * @brief run Push task to run in any ready thread.
          * @param task the task ready to run
          * @param after_task the work after task finished
-         * @return The running thread
          */
-        Thread *run(const Thread::task_type &task, const Thread::after_task_type &after_task);
+        void run(const task_type &task, const after_task_type &after_task);
 
         /**
-         * @brief join Wait all tasks working finish.
+         * @brief run Push task in group.
+         * @param group the group waiting task
+         * @param task the task ready to run
+         */
+        void run(Group &group, const task_type &task);
+
+        /**
+         * @brief join Wait all tasks pushed by calling thread finish.
+         * @note exception thrown in tasks will be rethrown
          */
         void join();
 
+        /**
+         * @brief join Wait all tasks in group finish.
+         * @param group the group waiting tasks
+         * @note exception thrown in tasks will be rethrown
+         */
+        void join(Group &group);
+
         /**
          * @brief busy Return if there are task running in thread
          * @return True if busy
@@ -114,25 +113,33 @@ namespace ts {
          */
         size_t size() const;
 
-    private:
+        /**
+         * @return index of calling thread in pool, -1 if calling thread not in pool
+         */
+        int signet() const;
 
         /**
-         * @brief load Get thread ready to run
-         * @return Get ready thread
+         * @brief set_spin_wait_time Set time of busy polling for next task, before thread blocking
+         * @param microseconds spin time, 0 means blocking at once
+         * @note both working threads and joining threads spin
          */
-        int load();
+        void set_spin_wait_time(int microseconds);
 
         /**
-         * @brief recycling_thread Recycle thread
-         * @param signet thread index
+         * @return spin time in microseconds
          */
-        void recycling_thread(int signet);
+        int get_spin_wait_time() const;
 
-        std::vector<Thread *> thread_pool;                     ///< all cartridges
+        /**
+         * @brief set_cpu_affinity Pin threads on cpus, i-th thread on cpu_ids[i % size]
+         * @param cpu_ids cpu ids, empty means cpus process can run on
+         * @note threads pinned before running next task
+         */
+        void set_cpu_affinity(const std::vector<int> &cpu_ids);
 
-        std::mutex running_core_mutex;                  ///< mutex to get cartridges
-        std::condition_variable running_core_cond;      ///< active when cartridge pushed in chest
-        std::deque<int> running_core;                  ///< save all cartridge ready to fire
+    private:
+        class Implement;
+        Declare<Implement> m_impl;
     };
 }
 
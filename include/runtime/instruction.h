@@ -8,6 +8,7 @@
 #include <memory>
 #include <global/operator_factory.h>
 #include "operator.h"
+#include "concat_buffer.h"
 
 namespace ts {
 
@@ -80,16 +81,18 @@ namespace ts {
         int m_data_index;
     };
 
-    class TS_DEBUG_API OperatorInstruction : public Instruction {
+    class TS_DEBUG_API OperatorInstruction : public StackInstruction {
     public:
         using self = OperatorInstruction;    ///< self class
         using shared = std::shared_ptr<self>;  ///< smart pointer
-        using supper = Instruction;
+        using supper = StackInstruction;
 
         explicit OperatorInstruction(const Operator::shared &func, int nargs, int nresults);
         explicit OperatorInstruction(const Operator::shared &func, int nargs, int nresults, const std::string &description);
 
-        void run(Workbench &workbench) final ;
+        using supper::run;
+
+        void run(Stack &stack) final;
 
         std::string str() const final;
 
@@ -99,10 +102,54 @@ namespace ts {
 
         Operator::shared op() const { return m_func; }
 
+        int nargs() const { return m_nargs; }
+
+        int nresults() const { return m_nresults; }
+
+        const std::string &description() const { return m_description; }
+
+        /**
+         * mark outputs are views of inputs, sharing memory without allocating, set by compiler
+         * @param view if operator is view
+         */
+        void set_view(bool view) { m_view = view; }
+
+        /**
+         * @return true if outputs are views of inputs, like reshape, flatten, squeeze and unsqueeze
+         */
+        bool is_view() const { return m_view; }
+
+        /**
+         * bind output buffer of concat, so concat takes buffer instead of copying inputs
+         * @param buffer concat buffer
+         */
+        void bind_concat_buffer(const ConcatBuffer::shared &buffer) { m_concat_buffer = buffer; }
+
+        /**
+         * bind slice of concat buffer, so output is written into the slice
+         * @param buffer concat buffer
+         * @param index index of concat input this operator produces
+         */
+        void bind_concat_slice(const ConcatBuffer::shared &buffer, int index) {
+            m_concat_slice = buffer;
+            m_concat_slice_index = index;
+        }
+
+        const ConcatBuffer::shared &concat_buffer() const { return m_concat_buffer; }
+
+        const ConcatBuffer::shared &concat_slice() const { return m_concat_slice; }
+
+        int concat_slice_index() const { return m_concat_slice_index; }
+
     private:
         Operator::shared m_func = nullptr;
         int m_nargs = 0;
         int m_nresults = 0;
+        bool m_view = false;
+
+        ConcatBuffer::shared m_concat_buffer;
+        ConcatBuffer::shared m_concat_slice;
+        int m_concat_slice_index = -1;
         std::string m_description;
 
         OperatorCreator::function m_creator = nullptr;
@@ -24,6 +24,45 @@ namespace ts {
             // [-0, +0, -]
             static Instruction::shared swap(int i, int j);
         };
+
+        /**
+         * \brief instruction only moving tensors on stack, built by Stack
+         */
+        class TS_DEBUG_API StackOperation : public StackInstruction {
+        public:
+            using self = StackOperation;    ///< self class
+            using shared = std::shared_ptr<self>;  ///< smart pointer
+            using supper = StackInstruction;
+
+            enum Code {
+                PUSH,               ///< push(arg0)
+                CLONE,              ///< clone(arg0)
+                ERASE,              ///< erase(arg0)
+                ERASE_RANGE,        ///< erase(arg0, arg1)
+                RING_SHIFT_LEFT,    ///< push(0) then erase(0)
+                SWAP,               ///< swap(arg0, arg1)
+            };
+
+            StackOperation(Code code, int arg0, int arg1, const std::string &description);
+
+            using supper::run;
+
+            void run(ts::Stack &stack) final;
+
+            std::string str() const final;
+
+            Code code() const { return m_code; }
+
+            int arg0() const { return m_arg0; }
+
+            int arg1() const { return m_arg1; }
+
+        private:
+            Code m_code;
+            int m_arg0;
+            int m_arg1;
+            std::string m_description;
+        };
     }
 }
 
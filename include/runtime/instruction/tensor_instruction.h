@@ -17,6 +17,52 @@ namespace ts {
             // [-1, +1, e]
             static Instruction::shared field(int index);
         };
+
+        /**
+         * \brief pack top size tensors into one, built by Tensor::pack
+         */
+        class TS_DEBUG_API PackInstruction : public StackInstruction {
+        public:
+            using self = PackInstruction;    ///< self class
+            using shared = std::shared_ptr<self>;  ///< smart pointer
+            using supper = StackInstruction;
+
+            explicit PackInstruction(size_t size);
+
+            using supper::run;
+
+            void run(ts::Stack &stack) final;
+
+            std::string str() const final;
+
+            size_t size() const { return m_size; }
+
+        private:
+            size_t m_size;
+        };
+
+        /**
+         * \brief replace top packed tensor by its field, built by Tensor::field
+         */
+        class TS_DEBUG_API FieldInstruction : public StackInstruction {
+        public:
+            using self = FieldInstruction;    ///< self class
+            using shared = std::shared_ptr<self>;  ///< smart pointer
+            using supper = StackInstruction;
+
+            explicit FieldInstruction(int index);
+
+            using supper::run;
+
+            void run(ts::Stack &stack) final;
+
+            std::string str() const final;
+
+            int index() const { return m_index; }
+
+        private:
+            int m_index;
+        };
     }
 }
 
@@ -10,6 +10,11 @@
 #include "module/module.h"
 #include "runtime/stack.h"
 #include "runtime/instruction.h"
+#include "memory/planner.h"
+#include "runtime/dataflow.h"
+#include "runtime/register_program.h"
+
+#include <mutex>
 
 namespace ts {
     class TS_DEBUG_API Program {
@@ -39,8 +44,43 @@ namespace ts {
          */
         static shared Compile(const Module::shared &module, const ComputingDevice &device, const std::string &options);
 
+        /**
+         * save compiled program: instructions, operators' params and data segment,
+         *     keyed by library version, TS_PROGRAM_FORMAT_VERSION, device and compile options
+         * @param stream stream to write
+         * @param program program built by Compile or Load
+         */
+        static void Save(StreamWriter &stream, const shared &program);
+
+        /**
+         * save to filename, file is replaced after written, so program loaded from it keeps its mapping
+         */
+        static void Save(const std::string &filename, const shared &program);
+
+        /**
+         * load program saved by Save, operators are initialized again, but nothing is compiled
+         * @param stream stream to read
+         * @param device device program running on
+         * @param options compile options
+         * @return loaded program
+         * @context Workbench for initializing operators
+         * @note throw Exception if program was saved by other library or format version, or with other device or options
+         */
+        static shared Load(StreamReader &stream, const ComputingDevice &device, const std::string &options);
+
+        /**
+         * load program by mapping file into memory, data segment uses the mapping without copy on CPU
+         */
+        static shared Load(const std::string &filename, const ComputingDevice &device, const std::string &options);
+
         shared clone() const;
 
+        /**
+         * clone program with own copy of data segment, allocated in current context
+         * @note used to place read-only weights on NUMA node of running workbench
+         */
+        shared replicate() const;
+
         void bind_filter(int slot, shared filter);
 
         shared input_filter(int slot) const;
@@ -73,11 +113,47 @@ namespace ts {
 
         const std::vector<std::string> &output_names() const;
 
+        /**
+         * @return if plan intermediate memory, set by compile option "--plan-memory"
+         */
+        bool plan_memory() const { return m_plan_memory; }
+
+        /**
+         * get static memory plan of given input signature
+         * @param signature string of inputs' dtype and shape
+         * @return memory plan, nullptr if not planned
+         * @note plans are shared between cloned programs
+         */
+        MemoryPlan::shared memory_plan(const std::string &signature) const;
+
+        /**
+         * set static memory plan of given input signature
+         * @param signature string of inputs' dtype and shape
+         * @param plan memory plan, nullptr to drop older plan
+         */
+        void memory_plan(const std::string &signature, MemoryPlan::shared plan);
+
+        /**
+         * @return dataflow graph of instructions, analysed in first call, nullptr if can not be analysed
+         */
+        Dataflow::shared dataflow() const;
+
+        /**
+         * @return if run in register form, set by compile option "--registers"
+         */
+        bool register_form() const { return m_register_form; }
+
+        /**
+         * @return register form of instructions, built in first call, nullptr if can not be analysed
+         */
+        RegisterProgram::shared register_program() const;
+
     private:
         Program(const ComputingDevice &device);
         Program(const ComputingDevice &device, const std::shared_ptr<std::mutex> &mutex);
 
         ComputingDevice m_device;
+        std::string m_options;      // compile options, key of saved program
 
         std::vector<Instruction::shared> m_program; // running function, program area
 
@@ -98,6 +174,22 @@ namespace ts {
 
         std::vector<std::string> m_input_names;
         std::vector<std::string> m_output_names;
+
+        class MemoryPlanCache {
+        public:
+            std::mutex mutex;
+            map<std::string, MemoryPlan::shared> plans;
+        };
+
+        bool m_plan_memory = false;
+        std::shared_ptr<MemoryPlanCache> m_memory_plans;
+
+        mutable std::once_flag m_dataflow_once;
+        mutable Dataflow::shared m_dataflow;
+
+        bool m_register_form = false;
+        mutable std::once_flag m_register_program_once;
+        mutable RegisterProgram::shared m_register_program;
     };
 
     class TS_DEBUG_API ProgramEnv {
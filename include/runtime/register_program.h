@@ -0,0 +1,75 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_REGISTER_PROGRAM_H
+#define TENSORSTACK_RUNTIME_REGISTER_PROGRAM_H
+
+#include "dataflow.h"
+#include "operator.h"
+
+#include <vector>
+
+namespace ts {
+    /**
+     * Register form of program, flattened from dataflow graph.
+     * Each step reads operands from fixed slots and writes one register, no stack instructions left.
+     * Registers are allocated by lifetime, so a register is reused after its last reading step.
+     */
+    class TS_DEBUG_API RegisterProgram {
+    public:
+        using self = RegisterProgram;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        class Operand {
+        public:
+            enum Kind {
+                ARGUMENT,   ///< index is input slot
+                DATA,       ///< index is data segment index
+                REGISTER,   ///< index is register
+            };
+
+            Kind kind = REGISTER;
+            int index = 0;
+        };
+
+        class Step {
+        public:
+            StackInstruction::shared instruction;
+            /**
+             * operator of instruction, nullptr if instruction is not OperatorInstruction, or bound to ConcatBuffer
+             */
+            Operator *op = nullptr;
+            std::vector<Operand> inputs;    ///< in pushing order
+            int output = -1;                ///< register, -1 if output never used
+            std::vector<int> release;       ///< registers last read in this step, released before output written
+        };
+
+        /**
+         * allocate registers over dataflow
+         * @param dataflow dataflow of program
+         * @return register form, nullptr if dataflow is nullptr
+         */
+        static shared Compile(const Dataflow::shared &dataflow);
+
+        const std::vector<Step> &steps() const { return m_steps; }
+
+        /**
+         * @return number of registers
+         */
+        int registers() const { return m_registers; }
+
+        /**
+         * @return operands as program outputs
+         */
+        const std::vector<Operand> &outputs() const { return m_outputs; }
+
+    private:
+        std::vector<Step> m_steps;
+        int m_registers = 0;
+        std::vector<Operand> m_outputs;
+    };
+}
+
+
+#endif //TENSORSTACK_RUNTIME_REGISTER_PROGRAM_H
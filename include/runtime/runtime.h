@@ -34,8 +34,100 @@ namespace ts {
 
         self clone() const;
 
+        /**
+         * build context sharing thread pools and settings, without memory controllers
+         * @return context running on same threads
+         */
+        self share() const;
+
         ThreadPool &thread_pool();
 
+        /**
+         * @return number of operators running concurrently in one run, 1 means running in instructions' order
+         */
+        int get_inter_op_thread_number() const;
+
+        /**
+         * set number of operators running concurrently in one run
+         * @param inter_op_thread_number 0 or 1 means running in order, negative number means all processors
+         * @note computing threads are divided between concurrent operators
+         */
+        void set_inter_op_thread_number(int inter_op_thread_number);
+
+        /**
+         * @return thread pool dispatching independent operators, nullptr if running in order
+         */
+        ThreadPool *inter_op_thread_pool();
+
+        /**
+         * @return microseconds of threads busy polling for next task, before blocking
+         */
+        int get_spin_wait_time() const;
+
+        /**
+         * set time of threads busy polling for next task, before blocking
+         * @param microseconds spin time, 0 means blocking at once
+         * @note spinning keeps cores hot between back-to-back operators, at cost of cpu usage
+         */
+        void set_spin_wait_time(int microseconds);
+
+        /**
+         * pin computing threads on cpus, i-th thread on cpu_ids[i % size]
+         * @param cpu_ids cpu ids, empty means not pinning
+         * @note calling thread and its OpenMP threads are pinned in bind_computing_threads
+         */
+        void set_cpu_affinity(const std::vector<int> &cpu_ids);
+
+        const std::vector<int> &get_cpu_affinity() const;
+
+        /**
+         * back CPU memory not smaller than 2MB with transparent huge pages, if allocated by workbench running this context
+         * @param enable true for using huge pages
+         * @note see cpu_set_huge_page for enabling in whole process
+         */
+        void set_cpu_huge_page(bool enable);
+
+        bool get_cpu_huge_page() const;
+
+        /**
+         * place CPU memory allocated by workbench running this context on NUMA node
+         * @param node NUMA node id, negative means no placement
+         * @note computing threads are not pinned here, see Workbench::set_numa_node
+         */
+        void set_numa_node(int node);
+
+        int get_numa_node() const;
+
+        /**
+         * pin calling thread and its OpenMP threads by cpu affinity, OpenMP threads are not pinned again if already pinned
+         * @return cpus calling thread could run on before, empty if not pinned
+         * @note restore calling thread by unbind_computing_threads after running, OpenMP threads keep pinned
+         * @note cpus of calling thread are read once per thread, changing them outside running workbench is not noticed
+         */
+        std::vector<int> bind_computing_threads() const;
+
+        /**
+         * restore calling thread pinned by bind_computing_threads
+         * @param caller_cpu_ids returned by bind_computing_threads
+         */
+        static void unbind_computing_threads(const std::vector<int> &caller_cpu_ids);
+
+        /**
+         * run on cores leased from shared compute pool, until unlease
+         * @param computing_thread_number number of cores leased
+         * @param thread_pool shared thread pool used instead of own one
+         */
+        void lease(int computing_thread_number, ThreadPool::shared thread_pool);
+
+        void unlease();
+
+        /**
+         * build context for one inter-op worker, sharing memory controllers
+         * @param computing_thread_number computing threads number in each operator
+         * @return context without any thread pool
+         */
+        self branch(int computing_thread_number) const;
+
          void bind_flow(SyncMemoryController::shared flow);
 
          void bind_dynamic(SyncMemoryController::shared dynamic);
@@ -49,6 +141,8 @@ namespace ts {
         static SyncMemoryController::shared DynamicMemory();
 
     private:
+        explicit RuntimeContext(int computing_thread_number);
+
         /**
          * Computing threads number. Used in OpenMP
          */
@@ -56,6 +150,44 @@ namespace ts {
 
         ThreadPool::shared m_thread_pool;
 
+        /**
+         * Operators running concurrently, dispatched on m_inter_op_thread_pool
+         */
+        int m_inter_op_thread_number = 1;
+
+        ThreadPool::shared m_inter_op_thread_pool;
+
+        /**
+         * Microseconds of threads spinning before blocking
+         */
+        int m_spin_wait_time = 0;
+
+        /**
+         * Cpus computing threads pinned on
+         */
+        std::vector<int> m_cpu_affinity;
+
+        /**
+         * Cpus calling thread pinned on, first one of m_cpu_affinity
+         */
+        std::vector<int> m_caller_cpu_ids;
+
+        /**
+         * Using huge pages for large CPU memory
+         */
+        bool m_cpu_huge_page = false;
+
+        /**
+         * NUMA node CPU memory placed on, -1 means no placement
+         */
+        int m_numa_node = -1;
+
+        /**
+         * Cores and thread pool leased from shared compute pool, used while running
+         */
+        int m_leased_thread_number = 0;
+        ThreadPool::shared m_leased_thread_pool;
+
         SyncMemoryController::shared m_flow;
         SyncMemoryController::shared m_dynamic;
     };
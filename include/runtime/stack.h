@@ -15,6 +15,7 @@
 #include <vector>
 #include <deque>
 #include <stack>
+#include <memory>
 
 
 namespace ts {
@@ -135,9 +136,7 @@ namespace ts {
          * @param shape new tensor's device
          * @return pointer to new tensor
          */
-        Tensor *push(DTYPE dtype, const Shape &shape, const MemoryDevice &device) {
-            return this->push(this->make(dtype, shape, device));
-        }
+        Tensor *push(DTYPE dtype, const Shape &shape, const MemoryDevice &device);
 
         /**
          * Push tensor with proto
@@ -344,6 +343,22 @@ namespace ts {
          */
         HardConverter::function converter() const;
 
+        /**
+         * preset memory for the tensor pushed next onto current top of stack, if the size and device match
+         * @param memory preset memory
+         * @note used to let operator write output into given buffer, see ConcatBuffer.
+         *     Only the push(dtype, shape, device) forms take it, tensors made but not pushed never do.
+         */
+        void preset(const Memory &memory) {
+            m_preset = std::make_shared<Memory>(memory);
+            m_preset_slot = m_stack.size();
+        }
+
+        /**
+         * drop preset memory, if not used
+         */
+        void clear_preset() { m_preset.reset(); }
+
         std::deque<Tensor>::const_iterator begin() const {
             return m_stack.begin() + m_base;
         }
@@ -370,6 +385,9 @@ namespace ts {
         std::stack<size_t> m_base_stack;          ///< save each call base
 
         mutable HardConverter::function m_converter = nullptr;    ///< convert memory in stack
+
+        std::shared_ptr<Memory> m_preset;        ///< memory for tensor pushed at m_preset_slot, nullptr if not set
+        size_t m_preset_slot = 0;
     };
 }
 
@@ -9,6 +9,8 @@
 #include <queue>
 #include <unordered_map>
 #include <stack>
+#include <functional>
+#include <future>
 
 #include <core/device_context.h>
 
@@ -28,6 +30,7 @@
 
 #include "program.h"
 #include "runtime/switcher.h"
+#include "memory/planner.h"
 
 namespace ts {
     class TS_DEBUG_API Workbench : public SetupContext<Workbench> {
@@ -35,6 +38,11 @@ namespace ts {
         using self = Workbench;    ///< self class
         using shared = std::shared_ptr<self>;  ///< smart pointer
 
+        /**
+         * called in async executor thread after run, exception is nullptr if succeed
+         */
+        using async_callback = std::function<void(Workbench &bench, std::exception_ptr exception)>;
+
         template<typename K, typename V>
         using map = std::unordered_map<K, V>;
 
@@ -80,6 +88,43 @@ namespace ts {
         // run graph
         void run();
 
+        /**
+         * run graph in async executor
+         * @param inputs inputs of this run, in slot order
+         * @param callback called after run, outputs can be read in callback
+         * @note runs not started when workbench released are failed, the callback gets exception,
+         *     and the workbench given to it must not be touched
+         * @note runs of one workbench are in calling order, each with its own inputs,
+         *     inputs of next run can be prepared at once, but do not run, setup or read outputs
+         *     in other thread before all async runs finished
+         */
+        void run_async(const std::vector<Tensor> &inputs, const async_callback &callback);
+
+        /**
+         * run graph in async executor, with copy of inputs set now
+         * @param callback called after run, outputs can be read in callback
+         */
+        void run_async(const async_callback &callback);
+
+        /**
+         * run graph in async executor
+         * @param inputs inputs of this run, in slot order
+         * @return future of outputs
+         */
+        std::future<std::vector<Tensor>> run_async(const std::vector<Tensor> &inputs);
+
+        /**
+         * run graph in async executor, with copy of inputs set now
+         * @return future of outputs
+         */
+        std::future<std::vector<Tensor>> run_async();
+
+        /**
+         * wait all async runs finished
+         * @note called in async callback of this workbench, waiting runs are run at once in calling thread
+         */
+        void join_async();
+
         // get output
         const Tensor &output(const std::string &name) const;
 
@@ -92,6 +137,12 @@ namespace ts {
         // clone an Workbench which can run
         Workbench::shared clone() const;
 
+        /**
+         * clone an Workbench which can run, sharing thread pools and program's data segment
+         * @return workbench with own stack, memory and operators
+         */
+        Workbench::shared fork() const;
+
         static shared Load(const Module::shared &module, const ComputingDevice &device);
 
         static shared Load(const Module::shared &module, const ComputingDevice &device, const std::string &options);
@@ -250,6 +301,14 @@ namespace ts {
         */
         bool set_cpu_power_mode(CpuEnable::CpuPowerMode cpu_mode);
 
+        /**
+         * pin computing threads on cpus of NUMA node, and place CPU memory allocated in running on node
+         * @param node NUMA node id, negative means no placement and no cpu affinity
+         * @param replicate copy data segment of setup program onto node, instead of sharing it
+         * @note memory allocated before this call is not moved, replicate after setup program
+         */
+        void set_numa_node(int node, bool replicate = false);
+
         SwitchControll::shared switch_controller();
 
     private:
@@ -292,10 +351,58 @@ namespace ts {
         std::string m_summary;
 
         SwitchControll::shared m_switch_controller;
+
+        // flow memory controller on computing memory device, supporting static memory plan
+        PlannedMemoryController::shared m_flow_planner;
+
+        // flow memory used by operators running concurrently
+        SyncMemoryController::shared m_parallel_flow_memory;
+
+        // requests of run_async, waiting in calling order, may live longer than workbench in executor
+        class AsyncQueue;
+        std::shared_ptr<AsyncQueue> m_async;
+
+        // stack of operator running in register form
+        Stack::shared m_register_stack;
+        std::vector<Tensor> m_registers;
     private:
         Operator::shared m_cast_op; ///< for input cast
 
         void cast_tensor(DTYPE dtype);
+
+        /**
+         * launch_offline with static memory plan of program
+         * @param program
+         * @param args
+         * @return
+         * The plan of args' signature is recorded in first run, then replayed.
+         */
+        std::vector<Tensor> launch_planned(Program::shared program, const std::vector<Tensor> &args);
+
+        /**
+         * run program's dataflow graph, independent operators dispatched on inter-op thread pool
+         * @param program running program, with arguments ready on stack
+         * @return false if program can not run in dataflow, nothing happen
+         */
+        bool launch_dataflow(const Program &program);
+
+        /**
+         * run program's register form, each step reading and writing registers directly
+         * @param program running program, with arguments ready on stack
+         * @return false if program can not run in register form, nothing happen
+         */
+        bool launch_registers(const Program &program);
+
+        /**
+         * fail waiting async runs, and wait running one finished, called in releasing workbench
+         */
+        void release_async();
+
+        /**
+         * run graph with given inputs, outputs are set
+         * @param inputs inputs in slot order
+         */
+        void run_inputs(const std::vector<Tensor> &inputs);
     };
 }
 
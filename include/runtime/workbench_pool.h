@@ -0,0 +1,79 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENSORSTACK_RUNTIME_WORKBENCH_POOL_H
+#define TENSORSTACK_RUNTIME_WORKBENCH_POOL_H
+
+#include "workbench.h"
+
+#include "utils/implement.h"
+
+namespace ts {
+    /**
+     * Pool of workbenches running one program in multi threads.
+     * Workbenches are forked from prototype, sharing thread pools and program's data segment,
+     *     each has own stack, flow memory and operators.
+     * Checked out workbench is used by one thread, returned to pool when released.
+     */
+    class TS_DEBUG_API WorkbenchPool {
+    public:
+        using self = WorkbenchPool;
+        using shared = std::shared_ptr<self>;  ///< smart pointer
+
+        class Statistics {
+        public:
+            int size = 0;               ///< number of workbenches
+            int idle = 0;               ///< number of workbenches not checked out
+            uint64_t checkouts = 0;     ///< number of checkout
+            uint64_t waits = 0;         ///< number of checkout waiting for returned workbench
+            uint64_t wait_time = 0;     ///< microseconds waiting in all checkout
+        };
+
+        /**
+         * @param prototype workbench with program setup, all workbenches in pool forked from it,
+         *     prototype itself is kept by caller and never checked out
+         * @param size number of workbenches, at least 1
+         */
+        WorkbenchPool(Workbench::shared prototype, int size);
+
+        /**
+         * spread workbenches over NUMA nodes, round robin,
+         *     workbenches on one node share thread pools and data segment
+         * @param prototype workbench with program setup, cloned onto each node then forked, kept by caller
+         * @param size number of workbenches, at least 1
+         * @param nodes NUMA node ids, empty means not placing
+         * @param replicate copy data segment onto each node, instead of sharing it across nodes
+         */
+        WorkbenchPool(Workbench::shared prototype, int size, const std::vector<int> &nodes, bool replicate);
+
+        ~WorkbenchPool();
+
+        WorkbenchPool(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+        /**
+         * get idle workbench, block until any returned
+         * @return workbench returned to pool when released
+         */
+        Workbench::shared checkout();
+
+        /**
+         * get idle workbench
+         * @return workbench returned to pool when released, nullptr if all checked out
+         */
+        Workbench::shared try_checkout();
+
+        int size() const;
+
+        Statistics statistics() const;
+
+    private:
+        class Implement;
+        Declare<Implement> m_impl;
+    };
+}
+
+
+#endif //TENSORSTACK_RUNTIME_WORKBENCH_POOL_H
@@ -4,6 +4,8 @@
 #include "platform.h"
 #include "utils/api.h"
 
+#include <vector>
+
 namespace ts{
 
     class TS_DEBUG_API CpuEnable{
@@ -15,6 +17,12 @@ namespace ts{
             LITTLECORE = 2
         };  
 
+        enum CpuAffinityPolicy{
+            COMPACT = 0,    ///< neighbour cores first, SMT siblings next to each other
+            SCATTER = 1,    ///< spread over packages and physical cores, SMT siblings last
+            PHYSICAL = 2,   ///< one cpu of each physical core, skip SMT siblings
+        };
+
     public:
         CpuEnable(){}
         ~CpuEnable(){}
@@ -25,6 +33,52 @@ namespace ts{
         static int get_cpu_little_num();
         static bool set_power_mode(CpuPowerMode mode);
         static CpuPowerMode get_power_mode();
+
+        /**
+         * @param policy order of cpus
+         * @return ids of cpus process can run on, ordered by policy, empty if not supported
+         * @note only support linux now
+         */
+        static std::vector<int> get_cpu_affinity(CpuAffinityPolicy policy);
+
+        /**
+         * @return ids of online NUMA nodes, empty if not supported
+         * @note only support linux now
+         */
+        static std::vector<int> get_numa_nodes();
+
+        /**
+         * @param node NUMA node id
+         * @return ids of cpus on node which process can run on, in compact order, empty if not supported
+         */
+        static std::vector<int> get_numa_node_cpus(int node);
+
+        /**
+         * pin calling thread on cpu
+         * @param cpu_id cpu id, negative means cpus process can run on
+         * @return true if success
+         */
+        static bool bind_thread(int cpu_id);
+
+        /**
+         * pin calling thread on set of cpus
+         * @param cpu_ids cpu ids, empty means cpus process can run on
+         * @return true if success
+         */
+        static bool bind_thread(const std::vector<int> &cpu_ids);
+
+        /**
+         * @return ids of cpus calling thread can run on, empty if not supported
+         */
+        static std::vector<int> get_thread_cpus();
+
+        /**
+         * pin calling thread and its OpenMP threads, i-th thread on cpu_ids[i % size]
+         * @param cpu_ids cpu ids, empty means cpus process can run on
+         * @param threads number of OpenMP threads
+         * @return true if success
+         */
+        static bool bind_computing_threads(const std::vector<int> &cpu_ids, int threads);
         
     };
 }
@@ -0,0 +1,40 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include <api/batching_workbench.h>
+
+#include "declare_batching_workbench.h"
+#include "declare_workbench.h"
+#include "declare_tensor.h"
+
+using namespace ts;
+
+ts_BatchingWorkbench *ts_new_BatchingWorkbench(ts_Workbench *workbench, int32_t max_batch_size, int32_t timeout) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    std::unique_ptr<ts_BatchingWorkbench> batching(new ts_BatchingWorkbench(
+            workbench->pointer, max_batch_size, timeout));
+    RETURN_OR_CATCH(batching.release(), nullptr)
+}
+
+void ts_free_BatchingWorkbench(const ts_BatchingWorkbench *batching) {
+    TRY_HEAD
+    delete batching;
+    TRY_TAIL
+}
+
+ts_Tensor *ts_BatchingWorkbench_run(ts_BatchingWorkbench *batching, const ts_Tensor *const *inputs, int32_t len) {
+    TRY_HEAD
+    if (!batching) throw Exception("NullPointerException: @param: 1");
+    if (!inputs && len > 0) throw Exception("NullPointerException: @param: 2");
+    std::vector<Tensor> ts_inputs;
+    for (int i = 0; i < len; ++i) {
+        if (!inputs[i]) throw Exception("NullPointerException: @param: inputs[" + std::to_string(i) + "]");
+        ts_inputs.emplace_back(**inputs[i]);
+    }
+    auto outputs = (*batching)->run(ts_inputs);
+    std::unique_ptr<ts_Tensor> packed(new ts_Tensor());
+    (*packed)->pack(outputs);
+    RETURN_OR_CATCH(packed.release(), nullptr)
+}
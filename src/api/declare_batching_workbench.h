@@ -0,0 +1,15 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_DECLARE_BATCHING_WORKBENCH_H
+#define TENNIS_API_DECLARE_BATCHING_WORKBENCH_H
+
+#include "api/batching_workbench.h"
+#include "declaration.h"
+
+#include "runtime/batching_workbench.h"
+
+DECLARE_API_TYPE(ts_BatchingWorkbench, ts::BatchingWorkbench)
+
+#endif //TENNIS_API_DECLARE_BATCHING_WORKBENCH_H
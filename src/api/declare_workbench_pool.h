@@ -0,0 +1,15 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#ifndef TENNIS_API_DECLARE_WORKBENCH_POOL_H
+#define TENNIS_API_DECLARE_WORKBENCH_POOL_H
+
+#include "api/workbench_pool.h"
+#include "declaration.h"
+
+#include "runtime/workbench_pool.h"
+
+DECLARE_API_TYPE(ts_WorkbenchPool, ts::WorkbenchPool)
+
+#endif //TENNIS_API_DECLARE_WORKBENCH_POOL_H
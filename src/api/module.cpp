@@ -16,6 +16,14 @@ ts_Module *ts_Module_Load(const char *filename, ts_SerializationFormat format) {
     RETURN_OR_CATCH(module.release(), nullptr)
 }
 
+ts_Module *ts_Module_LoadMapped(const char *filename, ts_SerializationFormat format) {
+    TRY_HEAD
+    if (!filename) throw Exception("NullPointerException: @param: 1");
+    std::unique_ptr<ts_Module> module(new ts_Module(
+            Module::LoadMapped(filename, Module::SerializationFormat(format))));
+    RETURN_OR_CATCH(module.release(), nullptr)
+}
+
 void ts_free_Module(const ts_Module *module) {
     TRY_HEAD
     delete module;
@@ -67,3 +67,22 @@ ts_Program_set_operator_param(ts_Program *program, const char *node_name, const
         (*program)->set_operator_param(node_name, param, **value);
     RETURN_OR_CATCH(ts_true, ts_false)
 }
+
+ts_bool ts_Program_Save(const ts_Program *program, const char *filename) {
+    TRY_HEAD
+        if (!program) throw Exception("NullPointerException: @param: 1");
+        if (!filename) throw Exception("NullPointerException: @param: 2");
+        Program::Save(filename, program->pointer);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_Program *ts_Program_Load(const char *filename, const ts_Device *device, const char *options) {
+    TRY_HEAD
+        if (!filename) throw Exception("NullPointerException: @param: 1");
+        if (!device) throw Exception("NullPointerException: @param: 2");
+        if (!options) throw Exception("NullPointerException: @param: 3");
+        std::unique_ptr<ts_Program> program(new ts_Program(
+                Program::Load(filename, ComputingDevice(device->type, device->id), options)
+        ));
+    RETURN_OR_CATCH(program.release(), nullptr)
+}
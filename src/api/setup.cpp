@@ -6,6 +6,7 @@
 #include "declaration.h"
 
 #include "global/setup.h"
+#include "kernels/cpu/memory_cpu.h"
 
 using namespace ts;
 
@@ -15,3 +16,9 @@ ts_bool ts_setup() {
     RETURN_OR_CATCH(ts_true, ts_false);
 }
 
+
+ts_bool ts_setup_cpu_huge_page(ts_bool enable) {
+    TRY_HEAD
+    cpu_set_huge_page(bool(enable));
+    RETURN_OR_CATCH(ts_true, ts_false);
+}
@@ -10,6 +10,9 @@
 #include "declare_image_filter.h"
 #include "declare_program.h"
 
+#include "utils/cpu.h"
+#include "runtime/compute_pool.h"
+
 using namespace ts;
 
 ts_Workbench *ts_Workbench_Load(const ts_Module *module, const ts_Device *device) {
@@ -58,6 +61,35 @@ ts_bool ts_Workbench_run(ts_Workbench *workbench) {
     RETURN_OR_CATCH(ts_true, ts_false)
 }
 
+ts_bool ts_Workbench_run_async(ts_Workbench *workbench, ts_Workbench_run_callback *callback, void *userdata) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->run_async([workbench, callback, userdata](Workbench &, std::exception_ptr exception) {
+        if (!callback) return;
+        ts_bool succeed = ts_true;
+        api::ClearLEM();
+        if (exception) {
+            succeed = ts_false;
+            try {
+                std::rethrow_exception(exception);
+            } catch (const std::exception &e) {
+                api::SetLEM(e.what());
+            } catch (...) {
+                api::SetLEM("Unknown exception");
+            }
+        }
+        callback(workbench, succeed, userdata);
+    });
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_join_async(ts_Workbench *workbench) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->join_async();
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
 ts_bool ts_Workbench_output(ts_Workbench *workbench, int32_t i, ts_Tensor *tensor) {
     TRY_HEAD
     if (!workbench) throw Exception("NullPointerException: @param: 1");
@@ -82,6 +114,59 @@ ts_bool ts_Workbench_set_computing_thread_number(ts_Workbench *workbench, int32_
     RETURN_OR_CATCH(ts_true, ts_false)
 }
 
+ts_bool ts_Workbench_set_inter_op_thread_number(ts_Workbench *workbench, int32_t number) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->runtime().set_inter_op_thread_number(number);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_set_spin_wait_time(ts_Workbench *workbench, int32_t microseconds) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->runtime().set_spin_wait_time(microseconds);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_set_cpu_huge_page(ts_Workbench *workbench, ts_bool enable) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->runtime().set_cpu_huge_page(bool(enable));
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_set_cpu_affinity(ts_Workbench *workbench, const int32_t *cpu_ids, int32_t len) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    if (!cpu_ids && len > 0) throw Exception("NullPointerException: @param: 2");
+    std::vector<int> affinity;
+    if (len > 0) affinity.assign(cpu_ids, cpu_ids + len);
+    (*workbench)->runtime().set_cpu_affinity(affinity);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_set_cpu_affinity_policy(ts_Workbench *workbench, ts_CpuAffinityPolicy policy) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    auto affinity = CpuEnable::get_cpu_affinity(CpuEnable::CpuAffinityPolicy(policy));
+    if (affinity.empty()) throw Exception("Can not get cpus of policy " + std::to_string(int(policy)));
+    (*workbench)->runtime().set_cpu_affinity(affinity);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_set_numa_node(ts_Workbench *workbench, int32_t node, ts_bool replicate) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    (*workbench)->set_numa_node(node, bool(replicate));
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
+ts_bool ts_Workbench_SetSharedComputePool(int32_t core_budget) {
+    TRY_HEAD
+    ComputePool::Setup(core_budget);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
+
 ts_bool ts_Workbench_bind_filter(ts_Workbench *workbench, int32_t i, const ts_ImageFilter *filter) {
     TRY_HEAD
         if (!workbench) throw Exception("NullPointerException: @param: 1");
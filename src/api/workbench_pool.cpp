@@ -0,0 +1,65 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include <api/workbench_pool.h>
+
+#include "declare_workbench_pool.h"
+#include "declare_workbench.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ts;
+
+ts_WorkbenchPool *ts_new_WorkbenchPool(ts_Workbench *workbench, int32_t size) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    std::unique_ptr<ts_WorkbenchPool> pool(new ts_WorkbenchPool(workbench->pointer, size));
+    RETURN_OR_CATCH(pool.release(), nullptr)
+}
+
+ts_WorkbenchPool *ts_new_WorkbenchPool_v2(ts_Workbench *workbench, int32_t size,
+                                          const int32_t *nodes, int32_t len, ts_bool replicate) {
+    TRY_HEAD
+    if (!workbench) throw Exception("NullPointerException: @param: 1");
+    if (!nodes && len > 0) throw Exception("NullPointerException: @param: 3");
+    std::vector<int> node_ids(nodes, nodes + std::max(len, 0));
+    std::unique_ptr<ts_WorkbenchPool> pool(new ts_WorkbenchPool(workbench->pointer, size, node_ids, bool(replicate)));
+    RETURN_OR_CATCH(pool.release(), nullptr)
+}
+
+void ts_free_WorkbenchPool(const ts_WorkbenchPool *pool) {
+    TRY_HEAD
+    delete pool;
+    TRY_TAIL
+}
+
+ts_Workbench *ts_WorkbenchPool_checkout(ts_WorkbenchPool *pool) {
+    TRY_HEAD
+    if (!pool) throw Exception("NullPointerException: @param: 1");
+    std::unique_ptr<ts_Workbench> workbench(new ts_Workbench((*pool)->checkout()));
+    RETURN_OR_CATCH(workbench.release(), nullptr)
+}
+
+ts_Workbench *ts_WorkbenchPool_try_checkout(ts_WorkbenchPool *pool) {
+    TRY_HEAD
+    if (!pool) throw Exception("NullPointerException: @param: 1");
+    auto bench = (*pool)->try_checkout();
+    if (bench == nullptr) return nullptr;
+    std::unique_ptr<ts_Workbench> workbench(new ts_Workbench(bench));
+    RETURN_OR_CATCH(workbench.release(), nullptr)
+}
+
+ts_bool ts_WorkbenchPool_statistics(ts_WorkbenchPool *pool, ts_WorkbenchPoolStatistics *statistics) {
+    TRY_HEAD
+    if (!pool) throw Exception("NullPointerException: @param: 1");
+    if (!statistics) throw Exception("NullPointerException: @param: 2");
+    auto stat = (*pool)->statistics();
+    statistics->size = stat.size;
+    statistics->idle = stat.idle;
+    statistics->checkouts = int64_t(stat.checkouts);
+    statistics->waits = int64_t(stat.waits);
+    statistics->wait_time = int64_t(stat.wait_time);
+    RETURN_OR_CATCH(ts_true, ts_false)
+}
@@ -22,6 +22,7 @@ namespace ts {
             field(name::dilation, OPTIONAL);
             field(name::typo::dialations, OPTIONAL);
             field(name::kernel_packed, OPTIONAL, tensor::from<bool>(false));
+            Epilogue::Field(*this);
         }
 
         static std::string to_string(const std::valarray<int> &arr) {
@@ -55,6 +56,8 @@ namespace ts {
                 dilation_tensor = tensor::cast(INT32, get(name::typo::dialations));
             }
 
+            m_epilogue = Epilogue::Parse(*this);
+
             if (dilation_tensor.empty()) {
                 TS_LOG_ERROR << this->op() << " must set " << name::dilation << " or " << name::typo::dialations << eject;
             }
@@ -178,6 +181,8 @@ namespace ts {
 
             Tensor out = *stack.push(output_protos[0], memory_device);
 
+            m_epilogue.check(op(), out.size(m_format == FORMAT_NCHW ? 1 : 3));
+
             Padding2D padding;
             Stride2D stride;
             Dilation2D dilation;
@@ -198,7 +203,7 @@ namespace ts {
 
                 TS_AUTO_CHECK(stack.size() == 0);
 
-                conv2d(x, padding, m_padding_value, w, stride, dilation, m_format, out, stack, m_kernel_packed);
+                conv2d(x, padding, m_padding_value, w, stride, dilation, m_format, out, stack, m_kernel_packed, m_epilogue);
 
                 stack.clear();
             }
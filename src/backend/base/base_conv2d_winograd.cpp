@@ -17,6 +17,8 @@ namespace ts {
             field(name::padding, REQUIRED);
             field(name::padding_value, OPTIONAL, tensor::from(0.0f));
             field(name::kernel_winograd_transformed, OPTIONAL, tensor::from<bool>(false));
+            field(name::winograd_mode, OPTIONAL);
+            Epilogue::Field(*this);
         }
 
         static std::string to_string(const std::valarray<int> &arr) {
@@ -41,6 +43,20 @@ namespace ts {
                 m_kernel_transformed = tensor::to_bool(get(name::kernel_winograd_transformed));
             }
 
+            m_epilogue = Epilogue::Parse(*this);
+
+            m_winograd_mode_fixed = has(name::winograd_mode);
+            if (m_winograd_mode_fixed) {
+                auto winograd_mode = tensor::to_string(get(name::winograd_mode));
+                if (winograd_mode == name::winograd_f63) {
+                    m_winograd_mode = F6X6_3X3;
+                } else if (winograd_mode == name::winograd_f23) {
+                    m_winograd_mode = F2X2_3X3;
+                } else {
+                    TS_LOG_ERROR << this->op() << " do not support winograd mode: " << winograd_mode << eject;
+                }
+            }
+
             TS_AUTO_CHECK(padding_tensor.has_shape({ 4, 2 }));
 
             if (format == name::NCHW) {
@@ -145,9 +161,11 @@ namespace ts {
             //warm up
             if(!m_kernel_transformed || m_k_transformed.empty()){
                 //select winograd mode
-                WinogradConv2DMode winograd_mode;
-                KernelCommonFunc<float>::winograd_mode_select_on_arm(x_tensor.sizes(), kernel_tensor.size(0), winograd_mode);
-                m_winograd_mode = winograd_mode;
+                WinogradConv2DMode winograd_mode = m_winograd_mode;
+                if (!m_winograd_mode_fixed) {
+                    KernelCommonFunc<float>::winograd_mode_select_on_arm(x_tensor.sizes(), kernel_tensor.size(0), winograd_mode);
+                    m_winograd_mode = winograd_mode;
+                }
 
                 Shape kernel_shape = kernel_tensor.sizes();
                 Shape kernel_transformed_shape;
@@ -161,7 +179,10 @@ namespace ts {
                 m_kernel_transformed = true;
             }
 
-            conv2d_winograd(x_tensor, m_winograd_mode, padding, m_padding_value, m_k_transformed, m_format, out, m_kernel_transformed);
+            m_epilogue.check(op(), out.size(m_format == FORMAT_NCHW ? 1 : 3));
+
+            conv2d_winograd(x_tensor, m_winograd_mode, padding, m_padding_value, m_k_transformed, m_format, out, m_kernel_transformed,
+                            m_epilogue);
 
 
             return 1;
@@ -0,0 +1,94 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "backend/base/base_epilogue.h"
+
+#include "backend/name.h"
+#include "core/tensor_builder.h"
+#include "runtime/operator.h"
+
+namespace ts {
+    namespace base {
+        bool Epilogue::empty() const {
+            return bias.empty() && activation == ActivationType::NONE;
+        }
+
+        void Epilogue::check(const std::string &op, int channels) const {
+            if (!bias.empty() && bias.count() != channels) {
+                TS_LOG_ERROR << op << " fused " << name::bias << " mismatch " << channels << " channels, got "
+                             << to_string(bias.sizes()) << eject;
+            }
+            if (activation == ActivationType::PRELU && slope.count() != channels && slope.count() != 1) {
+                TS_LOG_ERROR << op << " fused " << name::slope << " mismatch " << channels << " channels, got "
+                             << to_string(slope.sizes()) << eject;
+            }
+        }
+
+        void Epilogue::Field(Operator &op) {
+            op.field(name::bias, Operator::OPTIONAL);
+            op.field(name::activation, Operator::OPTIONAL);
+            op.field(name::max, Operator::OPTIONAL);
+            op.field(name::scale, Operator::OPTIONAL);
+            op.field(name::slope, Operator::OPTIONAL);
+        }
+
+        Epilogue Epilogue::Parse(const Operator &op) {
+            Epilogue epilogue;
+            if (op.has(name::bias)) {
+                epilogue.bias = op.get(name::bias);
+            }
+            if (!op.has(name::activation)) return epilogue;
+
+            auto activation = tensor::to_string(op.get(name::activation));
+            epilogue.activation = Activation(activation);
+            switch (epilogue.activation) {
+                default:
+                    TS_LOG_ERROR << "Not supported fused " << name::activation << ": " << activation << eject;
+                    break;
+                case ActivationType::RELU:
+                case ActivationType::SIGMOID:
+                    break;
+                case ActivationType::RELU_MAX:
+                    epilogue.max = op.has(name::max) ? tensor::to_float(op.get(name::max)) : 0;
+                    break;
+                case ActivationType::LEAKY_RELU:
+                    epilogue.scale = op.has(name::scale) ? tensor::to_float(op.get(name::scale)) : 0;
+                    break;
+                case ActivationType::PRELU:
+                    if (!op.has(name::slope)) {
+                        TS_LOG_ERROR << "Fused " << activation << " must set " << name::slope << eject;
+                    }
+                    epilogue.slope = op.get(name::slope);
+                    break;
+            }
+            return epilogue;
+        }
+
+        void Epilogue::Copy(const Operator &from, Operator &to) {
+            for (auto &param : {name::bias, name::activation, name::max, name::scale, name::slope}) {
+                if (from.has(param)) to.set(param, from.get(param));
+            }
+        }
+
+        ActivationType Epilogue::Activation(const std::string &op) {
+            if (op == name::layer::relu()) return ActivationType::RELU;
+            if (op == name::layer::relu_max()) return ActivationType::RELU_MAX;
+            if (op == name::layer::leaky_relu()) return ActivationType::LEAKY_RELU;
+            if (op == name::layer::prelu()) return ActivationType::PRELU;
+            if (op == name::layer::sigmoid()) return ActivationType::SIGMOID;
+            return ActivationType::NONE;
+        }
+
+        std::string Epilogue::Activation(ActivationType type) {
+            switch (type) {
+                default: return "";
+                case ActivationType::RELU: return name::layer::relu();
+                case ActivationType::RELU_MAX: return name::layer::relu_max();
+                case ActivationType::LEAKY_RELU: return name::layer::leaky_relu();
+                case ActivationType::PRELU: return name::layer::prelu();
+                case ActivationType::SIGMOID: return name::layer::sigmoid();
+            }
+        }
+    }
+}
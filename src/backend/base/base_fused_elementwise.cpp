@@ -0,0 +1,130 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "backend/base/base_fused_elementwise.h"
+#include "backend/base/element_wise_reduce.h"
+
+#include <utils/assert.h>
+
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+
+namespace ts {
+    namespace base {
+        FusedElementWise::FusedElementWise() {
+            field(name::code, REQUIRED);
+        }
+
+        void FusedElementWise::init() {
+            supper::init();
+
+            auto code = tensor::cast(INT32, this->get(name::code));
+            if (code.dims() != 2 || code.size(1) != 3 || code.size(0) < 1) {
+                TS_LOG_ERROR << "[" << this->op() << ":" << this->name() << "] "
+                             << name::code << " must be [steps, 3], got " << to_string(code.sizes()) << eject;
+            }
+
+            auto steps = code.size(0);
+            auto data = code.data<int32_t>();
+            m_steps.resize(steps);
+            for (int i = 0; i < steps; ++i) {
+                auto &step = m_steps[i];
+                step.opcode = data[3 * i];
+                step.lhs = data[3 * i + 1];
+                step.rhs = data[3 * i + 2];
+                if (step.opcode < ADD || step.opcode > ABS) {
+                    TS_LOG_ERROR << "[" << this->op() << ":" << this->name() << "] "
+                                 << "Not supported opcode " << step.opcode << " at step " << i << eject;
+                }
+            }
+        }
+
+        Tensor::Prototype FusedElementWise::infer_shape(Stack &stack, std::vector<Shape> &input_shapes) {
+            auto inputs = int(stack.size());
+            TS_AUTO_CHECK(inputs >= 1);
+
+            for (size_t i = 0; i < m_steps.size(); ++i) {
+                auto &step = m_steps[i];
+                auto registers = inputs + int(i);
+                if (step.lhs < 0 || step.lhs >= registers ||
+                    (!IsUnary(step.opcode) && (step.rhs < 0 || step.rhs >= registers))) {
+                    TS_LOG_ERROR << "[" << this->op() << ":" << this->name() << "] "
+                                 << "Step " << i << " reads register out of " << registers << eject;
+                }
+            }
+
+            auto dtype = stack[0].dtype();
+            Shape out_shape = stack[0].sizes();
+            for (int i = 1; i < inputs; ++i) {
+                auto &x = stack[i];
+                if (x.dtype() != dtype) {
+                    TS_LOG_ERROR << "[" << this->op() << ":" << this->name() << "] Can not reduce mismatch type: "
+                                 << type_str(dtype) << " vs. "
+                                 << type_str(x.dtype()) << eject;
+                }
+                auto lhs_shape = out_shape;
+                auto rhs_shape = x.sizes();
+                ElementWiseReduce::reduce(this, lhs_shape, rhs_shape, out_shape, true);
+            }
+
+            input_shapes.resize(inputs);
+            for (int i = 0; i < inputs; ++i) {
+                auto shape = stack[i].sizes();
+                Shape ones(out_shape.size() - shape.size(), 1);
+                shape.insert(shape.begin(), ones.begin(), ones.end());
+                input_shapes[i] = shape;
+            }
+
+            return Tensor::Prototype(dtype, out_shape);
+        }
+
+        int FusedElementWise::infer(Stack &stack, std::vector<Tensor::Prototype> &output) {
+            std::vector<Shape> input_shapes;
+
+            output.resize(1);
+            output[0] = infer_shape(stack, input_shapes);
+
+            return 1;
+        }
+
+        int FusedElementWise::run(Stack &stack) {
+            std::vector<Shape> input_shapes;
+            auto out_proto = infer_shape(stack, input_shapes);
+
+            auto memory_device = running_memory_device();
+
+            std::vector<Tensor> inputs(input_shapes.size());
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                inputs[i] = stack[i].view(memory_device).reshape(input_shapes[i]);
+            }
+
+            auto out = *stack.push(out_proto, memory_device);
+
+            fused_elementwise(inputs, m_steps, out);
+
+            return 1;
+        }
+
+        int FusedElementWise::Encode(const std::string &op) {
+            if (op == name::layer::add()) return ADD;
+            if (op == name::layer::sub()) return SUB;
+            if (op == name::layer::mul()) return MUL;
+            if (op == name::layer::div()) return DIV;
+            if (op == name::layer::maximum()) return MAXIMUM;
+            if (op == name::layer::relu()) return RELU;
+            if (op == name::layer::sigmoid()) return SIGMOID;
+            if (op == name::layer::tanh()) return TANH;
+            if (op == name::layer::exp()) return EXP;
+            if (op == name::layer::sqrt()) return SQRT;
+            if (op == name::layer::rsqrt()) return RSQRT;
+            if (op == name::layer::square()) return SQUARE;
+            if (op == name::layer::abs()) return ABS;
+            return -1;
+        }
+
+        bool FusedElementWise::IsUnary(int opcode) {
+            return opcode >= RELU;
+        }
+    }
+}
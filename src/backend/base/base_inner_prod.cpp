@@ -14,6 +14,7 @@ namespace ts {
         InnerProd::InnerProd() {
             field("transpose", OPTIONAL, tensor::from<bool>(false));
             field(name::kernel_packed, OPTIONAL, tensor::from<bool>(false));
+            Epilogue::Field(*this);
         }
 
         void InnerProd::init() {
@@ -24,6 +25,8 @@ namespace ts {
             if (has(name::kernel_packed)) {
                 m_kernel_packed = tensor::to_bool(get(name::kernel_packed));
             }
+
+            m_epilogue = Epilogue::Parse(*this);
         }
 
         static void infer_size(bool m_transpose, Tensor &lhs, const Tensor &rhs, std::vector<Tensor::Prototype> &output) {
@@ -87,7 +90,9 @@ namespace ts {
 
             auto &out = *stack.push(output[0], memory_device);
 
-            inner_prod(lhs, rhs, m_transpose, out, stack, m_kernel_packed);
+            m_epilogue.check(op(), out.size(1));
+
+            inner_prod(lhs, rhs, m_transpose, out, stack, m_kernel_packed, m_epilogue);
 
             return 1;
         }
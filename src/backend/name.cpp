@@ -33,6 +33,7 @@ namespace ts {
             const string &prelu() TS_NOEXCEPT { static string str = "prelu"; return str; }
             const string &relu_max() TS_NOEXCEPT { static string str = "relu_max"; return str; }
             const string &sigmoid() TS_NOEXCEPT { static string str = "sigmoid"; return str; }
+            const string &leaky_relu() TS_NOEXCEPT { static string str = "leaky_relu"; return str; }
             const string &softmax() TS_NOEXCEPT { static string str = "softmax"; return str; }
             const string &concat() TS_NOEXCEPT { static string str = "concat"; return str; }
             const string &flatten() TS_NOEXCEPT { static string str = "flatten"; return str; }
@@ -125,6 +126,10 @@ namespace ts {
             const string &proposal() TS_NOEXCEPT { static string str = "proposal"; return str; }
 
             const string &conv2d_winograd_v2() TS_NOEXCEPT { static string str = "conv2d_winograd_v2"; return str; }
+
+            const string &tanh() TS_NOEXCEPT { static string str = "tanh"; return str; }
+            const string &abs() TS_NOEXCEPT { static string str = "abs"; return str; }
+            const string &fused_elementwise() TS_NOEXCEPT { static string str = "_fused_elementwise"; return str; }
         }
 
         namespace typo {
@@ -212,5 +217,10 @@ namespace ts {
         string transpose = "transpose";
 
         string kernel_winograd_transformed = "kernel_winograd_transformed";
+
+        string bias = "bias";
+        string activation = "activation";
+
+        string code = "code";
     }
 }
@@ -18,6 +18,9 @@
 #include "runtime/instruction/instruction_factory.h"
 #include "runtime/instruction/stack_instruction.h"
 #include "runtime/instruction/tensor_instruction.h"
+#include "backend/base/base_new_shape.h"
+#include "backend/base/base_reshape_v2.h"
+#include "backend/zoo/copy.h"
 #include "global/operator_factory.h"
 #include "global/memory_device.h"
 #include "core/tensor_builder.h"
@@ -28,6 +31,14 @@
 #include "frontend/intime.h"
 #include "compiler/zipper.h"
 #include "compiler/translater.h"
+#include "compiler/argparse.h"
+#include "runtime/inferer.h"
+#include "utils/box.h"
+
+#include <functional>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
 
 
 
@@ -61,6 +72,65 @@ namespace ts {
         return map_node_refs;
     }
 
+    /**
+     * operators whose outputs are Tensor::reshape of inputs,
+     * including reshape, reshape_v2, flatten, flatten2d, squeeze, unsqueeze and _copy
+     */
+    static bool is_view_operator(const Operator::shared &op) {
+        return dynamic_cast<base::NewShape *>(op.get()) != nullptr ||
+               dynamic_cast<base::ReshapeV2 *>(op.get()) != nullptr ||
+               dynamic_cast<zoo::Copy *>(op.get()) != nullptr;
+    }
+
+    /**
+     * let producers of concat write into slices of concat output, see ConcatBuffer.
+     * each input of concat must be computed by an operator used by the concat only, views are passed through.
+     */
+    static void bind_concat_buffers(const std::vector<Node> &outputs,
+                                    const std::unordered_map<Node, OperatorInstruction::shared> &node_instructions) {
+        std::unordered_map<Node, int> refs;
+        for (auto &output : outputs) ++refs[output];
+        for (auto &node_instruction : node_instructions) {
+            for (auto &input : node_instruction.first.inputs()) ++refs[input];
+        }
+
+        auto instruction_of = [&](const Node &node) -> OperatorInstruction::shared {
+            auto it = node_instructions.find(node);
+            return it == node_instructions.end() ? nullptr : it->second;
+        };
+
+        for (auto &node_instruction : node_instructions) {
+            auto &concat = node_instruction.first;
+            if (concat.bubble().op() != name::layer::concat()) continue;
+            auto inputs = concat.inputs();
+            if (inputs.size() < 2) continue;
+
+            std::vector<OperatorInstruction::shared> producers;
+            for (auto &input : inputs) {
+                auto producer = input;
+                auto instruction = instruction_of(producer);
+                // views share memory with their input, so the input can write into slice
+                while (instruction != nullptr && instruction->is_view() &&
+                       refs[producer] == 1 && producer.inputs().size() == 1) {
+                    producer = producer.input(0);
+                    instruction = instruction_of(producer);
+                }
+                if (instruction == nullptr || instruction->is_view() || refs[producer] != 1 ||
+                    producer.bubble().op() == name::layer::concat()) {
+                    break;
+                }
+                producers.push_back(instruction);
+            }
+            if (producers.size() != inputs.size()) continue;
+
+            auto buffer = std::make_shared<ConcatBuffer>(tensor::to_int(concat.bubble().get(name::dim)));
+            node_instruction.second->bind_concat_buffer(buffer);
+            for (size_t i = 0; i < producers.size(); ++i) {
+                producers[i]->bind_concat_slice(buffer, int(i));
+            }
+        }
+    }
+
     std::vector<Instruction::shared> Compiler::convert_operator_instruction(const Node &node) {
         auto &bubble = node.bubble();
 
@@ -87,6 +157,7 @@ namespace ts {
         std::vector<Instruction::shared> instructions;
         auto op_inst = std::make_shared<OperatorInstruction>(op, int(node.inputs().size()), int(bubble.output_count()), description);
         op_inst->bind_creator(creator);
+        op_inst->set_view(is_view_operator(op));
         instructions.emplace_back(std::move(op_inst));
         if (bubble.output_count() != 1) {
             TS_LOG_ERROR << "All operators' output count must be 1." << eject;
@@ -94,6 +165,39 @@ namespace ts {
         return std::move(instructions);
     }
 
+    /**
+     * parse --input-shape=<name>:<dim>,<dim>,..., each dim is non-negative integer
+     */
+    static std::unordered_map<std::string, Shape> parse_input_shapes(const std::string &options) {
+        static const std::string prefix = "--input-shape=";
+        std::unordered_map<std::string, Shape> input_shapes;
+        for (auto &option : Split(options, " \t\r\n")) {
+            if (option.compare(0, prefix.size(), prefix) != 0) continue;
+            auto declare = option.substr(prefix.size());
+            auto colon = declare.rfind(':');
+            if (colon == std::string::npos || colon == 0) {
+                TS_LOG_ERROR << "Input shape must be declared as " << prefix << "<name>:<dim>,<dim>,..., got "
+                             << option << eject;
+            }
+            Shape shape;
+            auto dims = declare.substr(colon + 1);
+            // empty dims declare scalar
+            auto dim_list = dims.empty() ? std::vector<std::string>() : Split(dims, ",");
+            for (auto &dim : dim_list) {
+                bool digits = !dim.empty() && dim.find_first_not_of("0123456789") == std::string::npos;
+                errno = 0;
+                auto value = digits ? std::strtol(dim.c_str(), nullptr, 10) : -1;
+                if (!digits || errno == ERANGE || value > std::numeric_limits<int32_t>::max()) {
+                    TS_LOG_ERROR << "Input shape dim must be non-negative integer, got \"" << dim << "\" in "
+                                 << option << eject;
+                }
+                shape.push_back(int32_t(value));
+            }
+            input_shapes[declare.substr(0, colon)] = shape;
+        }
+        return input_shapes;
+    }
+
     // TODO: inputs only support Parameter, try support other op
     InstructionBlock Compiler::compile(const std::vector<Node> &raw_inputs, const std::vector<Node> &raw_outputs,
             const std::string &options) {
@@ -114,6 +218,21 @@ namespace ts {
             outputs = zipper.zip(outputs);
         }
 
+        ArgParser parser;
+        parser.add({"--fold-shape"}, {"--no-fold-shape"}, false);
+        parser.add({"--inplace-concat"}, {"--no-inplace-concat"}, false);
+        parser.parse(options);
+        bool fold_shape = parser.get("--fold-shape");
+        bool inplace_concat = parser.get("--inplace-concat");
+
+        // specialize shape computation for declared input shapes
+        if (fold_shape) {
+            TS_LOG_STATUS << "Compiling with --fold-shape";
+            std::vector<Node> folded_outputs;
+            fold_shape_nodes(inputs, parse_input_shapes(options), outputs, folded_outputs);
+            outputs = folded_outputs;
+        }
+
         // const graph
         {
             std::vector<Node> const_outputs;
@@ -121,6 +240,12 @@ namespace ts {
             outputs = const_outputs;
         }
 
+        if (fold_shape) {
+            std::vector<Node> static_outputs;
+            static_reshape_nodes(outputs, static_outputs);
+            outputs = static_outputs;
+        }
+
         // std::cout << "+++++++++++++++++ const graph ++++++++++++++++++++++" << std::endl;
         // plot_graph(std::cout, outputs);
 
@@ -141,6 +266,9 @@ namespace ts {
 
         map<Node, int> map_node_data_sagment_index;
 
+        // operator instruction computing each node
+        map<Node, OperatorInstruction::shared> map_node_instruction;
+
         // convert graph to instructions
         std::deque<Node> simulator;
         map<Node, size_t> working_nodes;
@@ -315,6 +443,10 @@ namespace ts {
 
             // case4: found a node need to be compute. query operator
             auto operator_instructions = convert_operator_instruction(node);
+            if (operator_instructions.size() == 1) {
+                auto op = std::dynamic_pointer_cast<OperatorInstruction>(operator_instructions[0]);
+                if (op != nullptr) map_node_instruction.insert(std::make_pair(node, op));
+            }
             for (auto inst_it = operator_instructions.rbegin(); inst_it != operator_instructions.rend(); ++inst_it) {
                 block.instructions.push_back(*inst_it);
             }
@@ -357,6 +489,10 @@ namespace ts {
         // inplace operator 是不是可以检测operator，如果是inplace操作，就把push换成clone。或者不支持inplace操作，最简单了。
         // 思考一下怎么处理额，可以在图的编译阶段，如果支持inplace操作，就插入一个copy节点。
 
+        if (inplace_concat) {
+            bind_concat_buffers(outputs, map_node_instruction);
+        }
+
         // reverse
         std::reverse(block.instructions.begin(), block.instructions.end());
 
@@ -449,4 +585,104 @@ namespace ts {
     InstructionBlock Compiler::compile(const std::vector<Node> &raw_inputs, const std::vector<Node> &outputs) {
         return compile(raw_inputs, outputs, "");
     }
+
+    using Rewriter = std::function<Node(const Node &node, const std::vector<Node> &inputs, bool changed)>;
+
+    /**
+     * rebuild graph by rewriter, nodes are copied if any input changed
+     */
+    static Node rewrite_node(const Node &node, std::unordered_map<Node, Node> &ready, const Rewriter &rewriter) {
+        auto ready_it = ready.find(node);
+        if (ready_it != ready.end()) return ready_it->second;
+
+        std::vector<Node> inputs;
+        bool changed = false;
+        for (auto &input : node.inputs()) {
+            inputs.emplace_back(rewrite_node(input, ready, rewriter));
+            changed = changed || inputs.back() != input;
+        }
+
+        auto rewritten = rewriter(node, inputs, changed);
+        if (rewritten == node && changed) {
+            rewritten = bubble::bubble(node.bubble());
+            Node::Link(rewritten, inputs);
+        }
+
+        ready.insert(std::make_pair(node, rewritten));
+        return rewritten;
+    }
+
+    static void rewrite_nodes(const std::vector<Node> &nodes, std::vector<Node> &rewritten_nodes,
+                              const Rewriter &rewriter) {
+        rewritten_nodes.clear();
+        std::unordered_map<Node, Node> ready;
+        for (auto &node : nodes) {
+            rewritten_nodes.emplace_back(rewrite_node(node, ready, rewriter));
+        }
+    }
+
+    static bool is_static_shape(const Shape &shape) {
+        for (auto dim : shape) {
+            if (dim < 0) return false;
+        }
+        return true;
+    }
+
+    void Compiler::fold_shape_nodes(const std::vector<Node> &inputs,
+                                    const std::unordered_map<std::string, Shape> &input_shapes,
+                                    const std::vector<Node> &nodes, std::vector<Node> &folded_nodes) {
+        std::unordered_map<Node, TensorPrototype> shapes;
+        for (auto &input : inputs) {
+            auto &bubble = input.bubble();
+            Shape shape;
+            auto declared = input_shapes.find(bubble.name());
+            if (declared != input_shapes.end()) {
+                shape = declared->second;
+            } else if (bubble.has(Bubble::RetentionParam::shape)) {
+                shape = bubble.shape();
+            } else {
+                continue;
+            }
+            if (!is_static_shape(shape)) continue;
+            auto dtype = bubble.dtype();
+            if (dtype == VOID) dtype = FLOAT32;
+            shapes.insert(std::make_pair(input, TensorPrototype(dtype, shape)));
+        }
+        if (shapes.empty()) {
+            TS_LOG_INFO << "No input shape declared, nothing to fold";
+            folded_nodes = nodes;
+            return;
+        }
+
+        int folded = 0;
+        rewrite_nodes(nodes, folded_nodes, [&](const Node &node, const std::vector<Node> &, bool) -> Node {
+            auto &bubble = node.bubble();
+            if (bubble.op() != name::layer::shape() || node.inputs().size() != 1) return node;
+            auto x = node.input(0);
+            TensorPrototype proto;
+            try {
+                proto = infer(x, shapes);
+            } catch (const Exception &) {
+                return node;
+            }
+            if (proto.dtype() == VOID || proto.fields_count() != 1 || !is_static_shape(proto.sizes())) return node;
+            ++folded;
+            return bubble::data(bubble.name(), tensor::build(INT32, proto.sizes()));
+        });
+
+        TS_LOG_INFO << "Folded " << folded << " " << name::layer::shape() << " node(s)";
+    }
+
+    void Compiler::static_reshape_nodes(const std::vector<Node> &nodes, std::vector<Node> &static_nodes) {
+        rewrite_nodes(nodes, static_nodes, [&](const Node &node, const std::vector<Node> &inputs, bool) -> Node {
+            auto &bubble = node.bubble();
+            if (bubble.op() != name::layer::reshape_v2() || inputs.size() != 2) return node;
+            if (inputs[1].bubble().op() != Bubble::Const) return node;
+            auto shape = tensor::cast(INT32, inputs[1].bubble().get(name::value));
+            if (shape.dims() != 1) return node;
+            auto reshape = bubble::op(bubble.name(), name::layer::reshape(), {inputs[0]});
+            reshape.bubble().set(name::shape, shape);
+            return reshape;
+        });
+    }
 }
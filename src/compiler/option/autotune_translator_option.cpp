@@ -0,0 +1,304 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/autotune_translator_option.h"
+
+#include "backend/name.h"
+#include "core/tensor_builder.h"
+#include "core/device_context.h"
+#include "module/menu.h"
+#include "runtime/inferer.h"
+#include "runtime/stack.h"
+#include "global/operator_factory.h"
+#include "kernels/common/function.h"
+#include "kernels/cpu/math_cpu.h"
+#include "utils/box.h"
+
+#ifdef TS_USE_OPENMP
+#include "kernels/common/openmp.h"
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <map>
+
+namespace ts {
+    static const char *const AUTOTUNE_GEMM = "gemm";
+    static const char *const AUTOTUNE_CACHE_PARAM = "--autotune-cache=";
+    static const int AUTOTUNE_TIMES = 3;
+
+    static std::string cpu_model() {
+#if defined(__linux__)
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            if (line.compare(0, 10, "model name") != 0) continue;
+            auto colon = line.find(':');
+            if (colon == std::string::npos) break;
+            auto model = line.substr(colon + 1);
+            auto begin = model.find_first_not_of(" \t");
+            return begin == std::string::npos ? std::string("unknown") : model.substr(begin);
+        }
+#endif
+        return "unknown";
+    }
+
+    static int tuning_threads() {
+#ifdef TS_USE_OPENMP
+        return openmp_threads();
+#else
+        return 1;
+#endif
+    }
+
+    /**
+     * tuning cache shared by all options in process, lines of "key\talgorithm"
+     */
+    class AutotuneCache {
+    public:
+        std::string find(const std::string &path, const std::string &key) {
+            std::unique_lock<std::mutex> _lock(m_mutex);
+            auto &records = load(path);
+            auto it = records.find(key);
+            return it == records.end() ? std::string() : it->second;
+        }
+
+        void save(const std::string &path, const std::string &key, const std::string &algorithm) {
+            std::unique_lock<std::mutex> _lock(m_mutex);
+            load(path)[key] = algorithm;
+            std::ofstream file(path, std::ios::app);
+            if (!file.is_open()) {
+                TS_LOG_ERROR << "Can not write autotune cache: " << path;
+                return;
+            }
+            file << key << '\t' << algorithm << std::endl;
+        }
+
+    private:
+        std::map<std::string, std::string> &load(const std::string &path) {
+            auto it = m_files.find(path);
+            if (it != m_files.end()) return it->second;
+            auto &records = m_files[path];
+            std::ifstream file(path);
+            std::string line;
+            while (std::getline(file, line)) {
+                auto tab = line.rfind('\t');
+                if (tab == std::string::npos) continue;
+                records[line.substr(0, tab)] = line.substr(tab + 1);
+            }
+            return records;
+        }
+
+        std::mutex m_mutex;
+        std::map<std::string, std::map<std::string, std::string>> m_files;
+    };
+
+    static AutotuneCache &autotune_cache() {
+        static AutotuneCache cache;
+        return cache;
+    }
+
+    static std::string join(const std::vector<int32_t> &values) {
+        std::ostringstream oss;
+        oss << "[";
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i) oss << ",";
+            oss << values[i];
+        }
+        oss << "]";
+        return oss.str();
+    }
+
+    static Tensor get_value(const Node &node) {
+        auto &bubble = node.bubble();
+        if (bubble.op() == Bubble::Const) return bubble.get(name::value);
+        if (bubble.has("#value")) return bubble.get("#value");
+        return Tensor();
+    }
+
+    /**
+     * @return seconds of fastest one in AUTOTUNE_TIMES runs, negative if op failed
+     */
+    static double measure(const ComputingDevice &device, const std::string &op_name,
+                          const std::map<std::string, Tensor> &params,
+                          const std::vector<Tensor> &inputs) {
+        auto op = OperatorCreator::CreateNoException(device.type(), op_name);
+        if (op == nullptr) return -1;
+
+        MemoryDevice memory_device(CPU);
+        Stack stack(memory_device);
+
+        DeviceContext device_context(device);
+        ctx::bind<DeviceContext> _bind_device_context(device_context);
+
+        double best = -1;
+        try {
+            for (auto &param : params) {
+                op->set(param.first, param.second);
+            }
+            op->init();
+            // first run is warm up, which may transform kernel
+            for (int i = 0; i <= AUTOTUNE_TIMES; ++i) {
+                for (auto &input : inputs) stack.push(input);
+                auto start = std::chrono::steady_clock::now();
+                op->run(stack);
+                auto end = std::chrono::steady_clock::now();
+                stack.clear();
+                if (i == 0) continue;
+                auto seconds = std::chrono::duration<double>(end - start).count();
+                if (best < 0 || seconds < best) best = seconds;
+            }
+        } catch (const Exception &) {
+            return -1;
+        }
+        return best;
+    }
+
+    AutotuneTranslatorOption::AutotuneTranslatorOption(const std::string &cache_path)
+            : m_cache_path(cache_path) {
+    }
+
+    std::string AutotuneTranslatorOption::CachePath(const std::string &params) {
+        std::string prefix = AUTOTUNE_CACHE_PARAM;
+        for (auto &param : Split(params, " \t\r\n")) {
+            if (param.size() > prefix.size() && param.compare(0, prefix.size(), prefix) == 0) {
+                return param.substr(prefix.size());
+            }
+        }
+        return "";
+    }
+
+    bool AutotuneTranslatorOption::translate(const ComputingDevice &device, const Node node,
+                                             Node &translated_node, const std::string &params,
+                                             bool output_flag) const {
+        if (device.type() != CPU) return false;
+
+        auto &bubble = node.bubble();
+        auto &op_name = bubble.op();
+        bool is_v2 = op_name == name::layer::conv2d_v2();
+        if (op_name != name::layer::conv2d() && !is_v2) return false;
+        if (tensor::to_string(bubble.get(name::format)) != name::NCHW) return false;
+        if (bubble.has(name::kernel_packed) && tensor::to_bool(bubble.get(name::kernel_packed))) return false;
+
+        auto inputs = node.inputs();
+        if (inputs.size() != (is_v2 ? 3U : 2U)) return false;
+        auto x_node = inputs[0];
+        auto w_node = inputs[is_v2 ? 2 : 1];
+        if (w_node.bubble().op() != Bubble::Const) return false;
+
+        auto padding = is_v2 ? get_value(inputs[1]) : bubble.get(name::padding);
+        if (padding.empty()) return false;
+        padding = tensor::cast(INT32, padding);
+        if (!padding.has_shape({4, 2})) return false;
+
+        auto w = w_node.bubble().get(name::value);
+        if (w.dtype() != FLOAT32 || w.dims() != 4) return false;
+
+        TensorPrototype x_proto;
+        try {
+            x_proto = infer(x_node, m_shapes);
+        } catch (const Exception &) {
+            return false;
+        }
+        if (x_proto.dtype() != FLOAT32 || x_proto.dims() != 4) return false;
+        for (auto dim : x_proto.sizes()) {
+            if (dim <= 0) return false;
+        }
+
+        std::vector<int32_t> stride4 = tensor::array::to_int(bubble.get(name::stride));
+        std::vector<int32_t> dilation4 = {1, 1, 1, 1};
+        if (bubble.has(name::dilation)) dilation4 = tensor::array::to_int(bubble.get(name::dilation));
+        else if (bubble.has(name::typo::dialations)) dilation4 = tensor::array::to_int(bubble.get(name::typo::dialations));
+        if (stride4.size() != 4 || dilation4.size() != 4) return false;
+
+        auto padding8 = tensor::array::to_int(padding);
+        float padding_value = bubble.has(name::padding_value) ? tensor::to_float(bubble.get(name::padding_value)) : 0;
+
+        std::vector<std::string> candidates = {AUTOTUNE_GEMM};
+        bool winograd = padding8[0] == 0 && padding8[1] == 0 && padding8[2] == 0 && padding8[3] == 0 &&
+                        KernelCommonFunc<float>::winograd_check(w.sizes(),
+                                                                Stride2D(stride4[2], stride4[3]),
+                                                                Dilation2D(dilation4[2], dilation4[3]));
+        if (winograd) {
+            candidates.push_back(name::winograd_f23);
+            candidates.push_back(name::winograd_f63);
+        }
+        if (candidates.size() < 2) return false;
+
+        std::ostringstream signature;
+        signature << cpu_model() << "|threads=" << tuning_threads()
+                  << "|conv2d x=" << join(std::vector<int32_t>(x_proto.sizes().begin(), x_proto.sizes().end()))
+                  << " w=" << join(std::vector<int32_t>(w.sizes().begin(), w.sizes().end()))
+                  << " padding=" << join(padding8) << " padding_value=" << padding_value
+                  << " stride=" << join(stride4) << " dilation=" << join(dilation4);
+        auto key = signature.str();
+
+        auto &cache = autotune_cache();
+        auto algorithm = cache.find(m_cache_path, key);
+        if (algorithm.empty()) {
+            Tensor x(FLOAT32, x_proto.sizes());
+            auto x_data = x.data<float>();
+            for (int i = 0; i < x.count(); ++i) x_data[i] = float(i % 17 - 8) / 8;
+
+            std::map<std::string, Tensor> common;
+            common[name::format] = bubble.get(name::format);
+            common[name::padding] = padding;
+            common[name::padding_value] = tensor::from(padding_value);
+            common[Bubble::RetentionParam::name] = tensor::from(bubble.name());
+
+            double best = -1;
+            for (auto &candidate : candidates) {
+                auto params = common;
+                std::string candidate_op;
+                auto kernel = w;
+                if (candidate == AUTOTUNE_GEMM) {
+                    candidate_op = name::layer::conv2d();
+                    params[name::stride] = bubble.get(name::stride);
+                    params[name::dilation] = tensor::build(INT32, dilation4);
+#ifndef TS_USE_CBLAS
+                    // deployed gemm uses kernel packed by --pack, so packing is not timed
+                    kernel = Tensor(w.dtype(), w.sizes());
+                    auto height = w.size(0);
+                    auto width = w.size(1) * w.size(2) * w.size(3);
+                    cpu::math<float, float>::pack8_A(height, width, w.data<float>(), width, kernel.data<float>());
+                    params[name::kernel_packed] = tensor::from<bool>(true);
+#endif
+                } else {
+                    candidate_op = name::layer::conv2d_winograd();
+                    params[name::winograd_mode] = tensor::from(candidate);
+                }
+                params[Bubble::RetentionParam::op] = tensor::from(candidate_op);
+                auto seconds = measure(device, candidate_op, params, {x, kernel});
+                if (seconds < 0) continue;
+                if (best < 0 || seconds < best) {
+                    best = seconds;
+                    algorithm = candidate;
+                }
+            }
+            if (algorithm.empty()) return false;
+            cache.save(m_cache_path, key, algorithm);
+        }
+
+        TS_LOG_DEBUG << "Autotune " << op_name << ":" << bubble.name() << " use " << algorithm;
+
+        if (algorithm != name::winograd_f23 && algorithm != name::winograd_f63) return false;
+
+        if (is_v2) {
+            translated_node = bubble::op(bubble.name(), name::layer::conv2d_winograd_v2(), inputs);
+        } else {
+            translated_node = bubble::op(bubble.name(), name::layer::conv2d_winograd(), {x_node, w_node});
+            translated_node.bubble().set(name::padding, padding);
+        }
+        auto &winograd_bubble = translated_node.bubble();
+        winograd_bubble.set(name::format, bubble.get(name::format));
+        winograd_bubble.set(name::winograd_mode, tensor::from(algorithm));
+        if (bubble.has(name::padding_value)) {
+            winograd_bubble.set(name::padding_value, bubble.get(name::padding_value));
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,229 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/batch_norm_translator_option.h"
+
+#include "backend/name.h"
+#include "core/tensor_builder.h"
+#include "module/menu.h"
+
+#include <cmath>
+
+namespace ts {
+    /**
+     * y = x * scale + shift along dim
+     */
+    class ChannelAffine {
+    public:
+        int dim = -1;
+        std::vector<double> scale;
+        std::vector<double> shift;
+    };
+
+    static bool is_const(const Node &node) {
+        return node.bubble().op() == Bubble::Const;
+    }
+
+    static std::vector<double> const_values(const Node &node) {
+        auto value = tensor::cast(FLOAT64, node.bubble().get(name::value));
+        auto data = value.data<double>();
+        return std::vector<double>(data, data + value.count());
+    }
+
+    /**
+     * @return false if node is not channel affine with constant parameters
+     */
+    static bool channel_affine(const Node &node, ChannelAffine &affine) {
+        auto &bubble = node.bubble();
+        auto &op = bubble.op();
+        auto inputs = node.inputs();
+        for (size_t i = 1; i < inputs.size(); ++i) {
+            if (!is_const(inputs[i])) return false;
+        }
+
+        if (op == name::layer::batch_norm() || op == name::layer::fused_batch_norm()) {
+            auto fused = op == name::layer::fused_batch_norm();
+            if (inputs.size() != (fused ? 5 : 3)) return false;
+            double epsilon = 1e-5;
+            if (bubble.has(name::epsilon)) epsilon = tensor::to_float(bubble.get(name::epsilon));
+            affine.dim = tensor::to_int(bubble.get(name::dim));
+            auto mean = const_values(inputs[1]);
+            auto variance = const_values(inputs[2]);
+            if (mean.size() != variance.size()) return false;
+            std::vector<double> gamma(mean.size(), 1), beta(mean.size(), 0);
+            if (fused) {
+                gamma = const_values(inputs[3]);
+                beta = const_values(inputs[4]);
+                if (gamma.size() != mean.size() || beta.size() != mean.size()) return false;
+            }
+            affine.scale.resize(mean.size());
+            affine.shift.resize(mean.size());
+            for (size_t i = 0; i < mean.size(); ++i) {
+                affine.scale[i] = gamma[i] / std::sqrt(variance[i] + epsilon);
+                affine.shift[i] = beta[i] - mean[i] * affine.scale[i];
+            }
+            return true;
+        } else if (op == name::layer::batch_scale()) {
+            if (inputs.size() != 3) return false;
+            affine.dim = tensor::to_int(bubble.get(name::dim));
+            affine.scale = const_values(inputs[1]);
+            affine.shift = const_values(inputs[2]);
+            return affine.scale.size() == affine.shift.size();
+        } else if (op == name::layer::add_bias()) {
+            if (inputs.size() != 2) return false;
+            if (bubble.has(name::dim)) {
+                affine.dim = tensor::to_int(bubble.get(name::dim));
+            } else if (bubble.has(name::format)) {
+                auto format = tensor::to_string(bubble.get(name::format));
+                if (format == name::NCHW) affine.dim = 1;
+                else if (format == name::NHWC) affine.dim = 3;
+                else return false;
+            } else {
+                return false;
+            }
+            affine.shift = const_values(inputs[1]);
+            affine.scale.resize(affine.shift.size(), 1);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @return input index of kernel, -1 if node is not foldable linear layer
+     */
+    static int linear_kernel_index(const Node &node, int &channel_dim) {
+        auto &bubble = node.bubble();
+        auto &op = bubble.op();
+        if (bubble.has(name::kernel_packed) && tensor::to_bool(bubble.get(name::kernel_packed))) return -1;
+        // fused bias or activation must be applied after kernel
+        if (bubble.has(name::bias) || bubble.has(name::activation)) return -1;
+
+        int kernel_index = -1;
+        bool depthwise = false;
+        if (op == name::layer::conv2d() || op == name::layer::depthwise_conv2d()) {
+            kernel_index = 1;
+            depthwise = op == name::layer::depthwise_conv2d();
+        } else if (op == name::layer::conv2d_v2() || op == name::layer::depthwise_conv2d_v2()) {
+            kernel_index = 2;
+            depthwise = op == name::layer::depthwise_conv2d_v2();
+        } else if (op == name::layer::inner_prod()) {
+            channel_dim = 1;
+            return node.inputs().size() == 2 && is_const(node.input(1)) ? 1 : -1;
+        } else {
+            return -1;
+        }
+
+        if (int(node.inputs().size()) != kernel_index + 1) return -1;
+        if (!is_const(node.input(kernel_index))) return -1;
+        auto format = tensor::to_string(bubble.get(name::format));
+        if (format == name::NCHW) {
+            channel_dim = 1;
+        } else if (format == name::NHWC && !depthwise) {
+            channel_dim = 3;
+        } else {
+            return -1;
+        }
+        return kernel_index;
+    }
+
+    /**
+     * scale kernel by output channels
+     * @return false if kernel can not be scaled
+     */
+    static bool scale_kernel(const Node &node, Tensor &kernel, const std::vector<double> &scale) {
+        auto &op = node.bubble().op();
+        auto channels = scale.size();
+        auto dtype = kernel.dtype();
+        if (dtype != FLOAT32 && dtype != FLOAT64) return false;
+        auto scaled = tensor::cast(FLOAT64, kernel);
+        auto data = scaled.data<double>();
+        auto count = size_t(scaled.count());
+
+        if (op == name::layer::inner_prod()) {
+            if (kernel.dims() != 2) return false;
+            auto transpose = node.bubble().has("transpose") && tensor::to_bool(node.bubble().get("transpose"));
+            auto rows = size_t(kernel.size(0));
+            auto cols = size_t(kernel.size(1));
+            if (transpose) {
+                // [M, K]
+                if (rows != channels) return false;
+                for (size_t i = 0; i < count; ++i) data[i] *= scale[i / cols];
+            } else {
+                // [K, M]
+                if (cols != channels) return false;
+                for (size_t i = 0; i < count; ++i) data[i] *= scale[i % cols];
+            }
+        } else if (op == name::layer::depthwise_conv2d() || op == name::layer::depthwise_conv2d_v2()) {
+            // [1, C, H, W]
+            if (kernel.dims() != 4 || kernel.size(0) != 1 || size_t(kernel.size(1)) != channels) return false;
+            auto width = count / channels;
+            for (size_t i = 0; i < count; ++i) data[i] *= scale[i / width];
+        } else {
+            // [O, ...]
+            if (kernel.dims() != 4 || size_t(kernel.size(0)) != channels) return false;
+            auto width = count / channels;
+            for (size_t i = 0; i < count; ++i) data[i] *= scale[i / width];
+        }
+
+        kernel = tensor::cast(dtype, scaled);
+        return true;
+    }
+
+    bool BatchNormTranslatorOption::translate(const ComputingDevice &device, const Node node,
+                                              Node &translated_node, const std::string &params,
+                                              bool output_flag) const {
+        // collect affine chain from bottom to top
+        std::vector<ChannelAffine> chain;
+        Node cursor = node;
+        while (true) {
+            ChannelAffine affine;
+            if (!channel_affine(cursor, affine)) break;
+            // nodes in chain can not be used by others
+            if (cursor != node && cursor.outputs().size() != 1) break;
+            chain.insert(chain.begin(), affine);
+            cursor = cursor.input(0);
+        }
+        if (chain.empty()) return false;
+        // only fold if there is any thing more than one bias
+        if (chain.size() == 1 && chain[0].scale == std::vector<double>(chain[0].scale.size(), 1)) return false;
+
+        auto linear = cursor;
+        if (linear.outputs().size() != 1) return false;
+        int channel_dim = -1;
+        auto kernel_index = linear_kernel_index(linear, channel_dim);
+        if (kernel_index < 0) return false;
+
+        auto channels = chain[0].scale.size();
+        std::vector<double> scale(channels, 1), shift(channels, 0);
+        for (auto &affine : chain) {
+            if (affine.dim != channel_dim || affine.scale.size() != channels) return false;
+            for (size_t i = 0; i < channels; ++i) {
+                scale[i] *= affine.scale[i];
+                shift[i] = shift[i] * affine.scale[i] + affine.shift[i];
+            }
+        }
+
+        auto kernel_node = linear.input(kernel_index);
+        auto kernel = kernel_node.bubble().get(name::value);
+        auto dtype = kernel.dtype();
+        if (!scale_kernel(linear, kernel, scale)) return false;
+
+        auto scaled_kernel_node = bubble::bubble(kernel_node.bubble(), kernel_node.bubble().name() + "_folded");
+        scaled_kernel_node.bubble().set(name::value, kernel);
+
+        auto linear_inputs = linear.inputs();
+        linear_inputs[kernel_index] = scaled_kernel_node;
+        auto folded_linear = bubble::bubble(linear.bubble());
+        Node::Link(folded_linear, linear_inputs);
+
+        auto bias = tensor::build(dtype, shift);
+        auto bias_node = bubble::data(node.bubble().name() + "_folded_bias", bias);
+        translated_node = bubble::op(node.bubble().name(), name::layer::add_bias(), {folded_linear, bias_node});
+        translated_node.bubble().set(name::dim, tensor::from<int32_t>(channel_dim));
+
+        return true;
+    }
+}
+
+TS_REGISTER_TRANSLATOR_OPTION(ts::BatchNormTranslatorOption)
@@ -0,0 +1,89 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/elementwise_translator_option.h"
+
+#include "backend/name.h"
+#include "backend/base/base_fused_elementwise.h"
+#include "core/tensor_builder.h"
+#include "module/menu.h"
+#include "global/operator_factory.h"
+
+#include <algorithm>
+
+namespace ts {
+    using Step = base::FusedElementWise::Step;
+
+    static int fusible_opcode(const Node &node) {
+        auto opcode = base::FusedElementWise::Encode(node.bubble().op());
+        if (opcode < 0) return -1;
+        auto inputs = node.inputs().size();
+        if (inputs != (base::FusedElementWise::IsUnary(opcode) ? 1U : 2U)) return -1;
+        return opcode;
+    }
+
+    /**
+     * check consumers still reading node, copies linked to node by former translation are skipped
+     */
+    static bool single_consumer(const Node &node) {
+        size_t count = 0;
+        for (auto &output : node.outputs()) {
+            if (output.expired()) continue;
+            auto inputs = output.inputs();
+            if (std::find(inputs.begin(), inputs.end(), node) != inputs.end()) ++count;
+        }
+        return count == 1;
+    }
+
+    /**
+     * append steps computing node to steps, inputs of chain are appended to leaves
+     * @return index of step writing node, or -1 - index of leaf if node is not fused
+     */
+    static int collect(const Node &node, bool root, std::vector<Node> &leaves, std::vector<Step> &steps) {
+        auto opcode = fusible_opcode(node);
+        if (!root && (opcode < 0 || !single_consumer(node))) {
+            auto it = std::find(leaves.begin(), leaves.end(), node);
+            if (it != leaves.end()) return -1 - int(it - leaves.begin());
+            leaves.push_back(node);
+            return -int(leaves.size());
+        }
+
+        auto inputs = node.inputs();
+        Step step;
+        step.opcode = opcode;
+        step.lhs = collect(inputs[0], false, leaves, steps);
+        step.rhs = base::FusedElementWise::IsUnary(opcode) ? -1 : collect(inputs[1], false, leaves, steps);
+        steps.push_back(step);
+        return int(steps.size()) - 1;
+    }
+
+    bool ElementWiseTranslatorOption::translate(const ComputingDevice &device, const Node node,
+                                                Node &translated_node, const std::string &params,
+                                                bool output_flag) const {
+        if (fusible_opcode(node) < 0) return false;
+        if (OperatorCreator::Query(device.type(), name::layer::fused_elementwise(), true) == nullptr) return false;
+
+        std::vector<Node> leaves;
+        std::vector<Step> steps;
+        collect(node, true, leaves, steps);
+        if (steps.size() < 2) return false;
+
+        // registers [0, leaves) are inputs, then each step's result
+        auto input_number = int(leaves.size());
+        auto reg = [&](int r) { return r < 0 ? -1 - r : input_number + r; };
+
+        Tensor code(INT32, {int(steps.size()), 3});
+        auto data = code.data<int32_t>();
+        for (auto &step : steps) {
+            *data++ = step.opcode;
+            *data++ = reg(step.lhs);
+            *data++ = base::FusedElementWise::IsUnary(step.opcode) ? -1 : reg(step.rhs);
+        }
+
+        translated_node = bubble::op(node.bubble().name(), name::layer::fused_elementwise(), leaves);
+        translated_node.bubble().set(name::code, code);
+
+        return true;
+    }
+}
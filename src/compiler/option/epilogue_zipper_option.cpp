@@ -0,0 +1,112 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/epilogue_zipper_option.h"
+
+#include "backend/name.h"
+#include "backend/base/base_epilogue.h"
+#include "core/tensor_builder.h"
+#include "module/menu.h"
+
+namespace ts {
+    static bool is_const(const Node &node) {
+        return node.bubble().op() == Bubble::Const;
+    }
+
+    /**
+     * @return channel dim of output if node supports epilogue, -1 otherwise
+     */
+    static int linear_channel_dim(const Node &node) {
+        auto &bubble = node.bubble();
+        auto &op = bubble.op();
+        if (op == name::layer::inner_prod()) return 1;
+        if (op == name::layer::conv2d() || op == name::layer::conv2d_v2() ||
+            op == name::layer::conv2d_winograd() || op == name::layer::conv2d_winograd_v2()) {
+            // cpu kernels only support NCHW
+            if (tensor::to_string(bubble.get(name::format)) != name::NCHW) return -1;
+            return 1;
+        }
+        return -1;
+    }
+
+    static int add_bias_dim(const Bubble &bubble) {
+        if (bubble.has(name::dim)) return tensor::to_int(bubble.get(name::dim));
+        if (bubble.has(name::format)) {
+            auto format = tensor::to_string(bubble.get(name::format));
+            if (format == name::NCHW) return 1;
+            if (format == name::NHWC) return 3;
+        }
+        return -1;
+    }
+
+    bool EpilogueZipperOption::zip(const ComputingDevice &device, Node node, Node &zipped_node) const {
+        if (device.type() != CPU) return false;
+
+        Node cursor = node;
+
+        auto activation = base::Epilogue::Activation(node.bubble().op());
+        if (activation != ActivationType::NONE) {
+            auto inputs = node.inputs();
+            if (activation == ActivationType::PRELU) {
+                if (inputs.size() != 2 || !is_const(inputs[1])) return false;
+            } else {
+                if (inputs.size() != 1) return false;
+            }
+            cursor = inputs[0];
+        }
+
+        Tensor bias;
+        int bias_dim = -1;
+        if (cursor.bubble().op() == name::layer::add_bias()) {
+            auto inputs = cursor.inputs();
+            if (inputs.size() != 2 || !is_const(inputs[1])) return false;
+            // add_bias can not be used by others, if it is fused with activation
+            if (cursor != node && cursor.outputs().size() != 1) return false;
+            bias = inputs[1].bubble().get(name::value);
+            bias_dim = add_bias_dim(cursor.bubble());
+            cursor = inputs[0];
+        }
+
+        if (activation == ActivationType::NONE && bias.empty()) return false;
+
+        auto linear = cursor;
+        if (linear.outputs().size() != 1) return false;
+        auto channel_dim = linear_channel_dim(linear);
+        if (channel_dim < 0) return false;
+
+        auto &linear_bubble = linear.bubble();
+        // activation must be the last one
+        if (linear_bubble.has(name::activation)) return false;
+        if (!bias.empty() && (linear_bubble.has(name::bias) || bias_dim != channel_dim)) return false;
+
+        Tensor slope;
+        if (activation == ActivationType::PRELU) {
+            auto &bubble = node.bubble();
+            if (!bubble.has(name::dim) || tensor::to_int(bubble.get(name::dim)) != channel_dim) return false;
+            slope = node.input(1).bubble().get(name::value);
+        }
+
+        zipped_node = bubble::bubble(linear_bubble, node.bubble().name());
+        auto &fused = zipped_node.bubble();
+        if (!bias.empty()) {
+            fused.set(name::bias, bias);
+        }
+        if (activation != ActivationType::NONE) {
+            auto &bubble = node.bubble();
+            fused.set(name::activation, tensor::from(base::Epilogue::Activation(activation)));
+            if (activation == ActivationType::RELU_MAX && bubble.has(name::max)) {
+                fused.set(name::max, bubble.get(name::max));
+            } else if (activation == ActivationType::LEAKY_RELU && bubble.has(name::scale)) {
+                fused.set(name::scale, bubble.get(name::scale));
+            } else if (activation == ActivationType::PRELU) {
+                fused.set(name::slope, slope);
+            }
+        }
+        Node::Link(zipped_node, linear.inputs());
+
+        return true;
+    }
+}
+
+TS_REGISTER_ZIPPER_OPTION(ts::EpilogueZipperOption)
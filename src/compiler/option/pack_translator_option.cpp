@@ -78,6 +78,7 @@ bool ts::PackTranslatorOption::translate(const ComputingDevice &device, const No
                     break;
                 }
             }
+            A_trans_node = bubble::bubble(A_node.bubble());
             A_trans_node.bubble().set(name::value, transposed);
         }
 
@@ -97,6 +98,7 @@ bool ts::PackTranslatorOption::translate(const ComputingDevice &device, const No
                     break;
                 }
             }
+            B_trans_node = bubble::bubble(B_node.bubble());
             B_trans_node.bubble().set(name::value, transposed);
         }
 
@@ -224,7 +226,8 @@ bool ts::PackTranslatorOption::translate(const ComputingDevice &device, const No
     }
 
 
-    Node kernel_packed_node = kernel_node;
+    // do not write back to original module, which may be compiled again
+    Node kernel_packed_node = bubble::bubble(kernel_node.bubble());
     kernel_packed_node.bubble().set(name::value, kernel_packed);
     translated_node.bubble().set(name::kernel_packed, tensor::from<bool>(true));
 
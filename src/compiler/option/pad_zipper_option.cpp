@@ -0,0 +1,170 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/pad_zipper_option.h"
+
+#include "backend/name.h"
+#include "backend/common_structure.h"
+#include "core/tensor_builder.h"
+#include "module/menu.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ts {
+    static bool is_const(const Node &node) {
+        return node.bubble().op() == Bubble::Const;
+    }
+
+    /**
+     * @return false if tensor is not padding in shape [4, 2]
+     */
+    static bool padding4x2(const Tensor &tensor, std::vector<int32_t> &padding) {
+        auto padding_tensor = tensor::cast(INT32, tensor);
+        if (!padding_tensor.has_shape({4, 2})) return false;
+        auto data = padding_tensor.data<int32_t>();
+        padding = std::vector<int32_t>(data, data + 8);
+        return true;
+    }
+
+    /**
+     * @return index of padding input, -1 if padding is param, -2 if node is not supported
+     */
+    static int padding_index(const Node &node, bool &pooling) {
+        auto &op = node.bubble().op();
+        pooling = false;
+        if (op == name::layer::conv2d() || op == name::layer::depthwise_conv2d()) return -1;
+        if (op == name::layer::conv2d_v2() || op == name::layer::depthwise_conv2d_v2()) return 1;
+        pooling = true;
+        if (op == name::layer::pooling2d()) return -1;
+        if (op == name::layer::pooling2d_v2()) return 1;
+        return -2;
+    }
+
+    static bool is_negative_infinity(float value) {
+        return value <= std::numeric_limits<float>::lowest() || (std::isinf(value) && value < 0);
+    }
+
+    /**
+     * check if pooling has the same output after padding is enlarged with value
+     */
+    static bool pooling_can_pad(const Node &node, float value,
+                                const std::vector<int32_t> &padding, const std::vector<int> &spatial) {
+        auto &bubble = node.bubble();
+        auto type = Pooling2DType::MAX;
+        if (bubble.has(name::type)) type = Pooling2DType(tensor::to_int(bubble.get(name::type)));
+        auto padding_type = Padding2DType::BLACK;
+        if (bubble.has(name::padding_type)) padding_type = Padding2DType(tensor::to_int(bubble.get(name::padding_type)));
+
+        if (type == Pooling2DType::AVG) {
+            // WHITE counts padding as 0 for every window, BLACK ignores padding
+            return padding_type == Padding2DType::WHITE && value == 0;
+        }
+        if (type != Pooling2DType::MAX) return false;
+        if (padding_type != Padding2DType::BLACK && padding_type != Padding2DType::WHITE) return false;
+        if (!is_negative_infinity(value)) return false;
+
+        // window must not only cover padding
+        Tensor ksize_tensor;
+        Tensor stride_tensor;
+        if (bubble.op() == name::layer::pooling2d_v2()) {
+            if (node.inputs().size() != 4 || !is_const(node.input(2)) || !is_const(node.input(3))) return false;
+            ksize_tensor = node.input(2).bubble().get(name::value);
+            stride_tensor = node.input(3).bubble().get(name::value);
+        } else {
+            ksize_tensor = bubble.get(name::ksize);
+            stride_tensor = bubble.get(name::stride);
+        }
+        ksize_tensor = tensor::cast(INT32, ksize_tensor);
+        stride_tensor = tensor::cast(INT32, stride_tensor);
+        if (!ksize_tensor.has_shape({4,}) || !stride_tensor.has_shape({4,})) return false;
+        for (auto dim : spatial) {
+            auto ksize = ksize_tensor.data<int32_t>(dim);
+            auto stride = stride_tensor.data<int32_t>(dim);
+            if (padding[dim * 2] >= ksize) return false;
+            // output size is rounded up, so last window starts before end of input only if so
+            if (padding[dim * 2 + 1] > ksize - stride) return false;
+        }
+        return true;
+    }
+
+    bool PadZipperOption::zip(const ComputingDevice &device, Node node, Node &zipped_node) const {
+        bool pooling = false;
+        auto index = padding_index(node, pooling);
+        if (index < -1) return false;
+        if (node.inputs().empty()) return false;
+
+        auto pad = node.input(0);
+        if (pad.bubble().op() != name::layer::pad()) return false;
+        if (pad.inputs().size() != 2 || !is_const(pad.input(1))) return false;
+        // padded tensor can not be used by others
+        if (pad.outputs().size() != 1) return false;
+
+        auto &bubble = node.bubble();
+        std::vector<int> spatial;
+        auto format = tensor::to_string(bubble.get(name::format));
+        if (format == name::NCHW) {
+            spatial = {2, 3};
+        } else if (format == name::NHWC) {
+            spatial = {1, 2};
+        } else {
+            return false;
+        }
+
+        std::vector<int32_t> pad_padding;
+        if (!padding4x2(pad.input(1).bubble().get(name::value), pad_padding)) return false;
+        for (int dim = 0; dim < 4; ++dim) {
+            auto is_spatial = dim == spatial[0] || dim == spatial[1];
+            for (int i = dim * 2; i < dim * 2 + 2; ++i) {
+                // negative padding crops input
+                if (pad_padding[i] < 0 || (!is_spatial && pad_padding[i] != 0)) return false;
+            }
+        }
+        float pad_value = 0;
+        if (pad.bubble().has(name::padding_value)) pad_value = tensor::to_float(pad.bubble().get(name::padding_value));
+
+        std::vector<int32_t> padding;
+        if (index < 0) {
+            if (!padding4x2(bubble.get(name::padding), padding)) return false;
+        } else {
+            if (int(node.inputs().size()) <= index || !is_const(node.input(index))) return false;
+            if (!padding4x2(node.input(index).bubble().get(name::value), padding)) return false;
+        }
+        bool has_padding = false;
+        for (size_t i = 0; i < padding.size(); ++i) {
+            if (padding[i] != 0) has_padding = true;
+            padding[i] += pad_padding[i];
+        }
+
+        if (pooling) {
+            if (!pooling_can_pad(node, pad_value, padding, spatial)) return false;
+        } else {
+            float padding_value = 0;
+            if (bubble.has(name::padding_value)) padding_value = tensor::to_float(bubble.get(name::padding_value));
+            // conv has only one padding_value for all padding
+            if (has_padding && padding_value != pad_value) return false;
+        }
+
+        auto padding_tensor = tensor::build(INT32, {4, 2}, padding);
+
+        auto inputs = node.inputs();
+        inputs[0] = pad.input(0);
+        zipped_node = bubble::bubble(bubble);
+        if (index < 0) {
+            zipped_node.bubble().set(name::padding, padding_tensor);
+        } else {
+            inputs[index] = bubble::data(bubble.name() + "_padding", padding_tensor);
+        }
+        if (!pooling) {
+            zipped_node.bubble().set(name::padding_value, tensor::from<float>(pad_value));
+        }
+        Node::Link(zipped_node, inputs);
+
+        TS_LOG_DEBUG << "Fold " << pad.str() << " into " << node.str();
+
+        return true;
+    }
+}
+
+TS_REGISTER_ZIPPER_OPTION(ts::PadZipperOption)
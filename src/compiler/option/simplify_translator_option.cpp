@@ -0,0 +1,158 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/simplify_translator_option.h"
+
+#include "module/menu.h"
+
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ts {
+    static size_t hash_combine(size_t seed, size_t value) {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
+
+    static size_t hash_tensor(const Tensor &tensor) {
+        size_t seed = std::hash<int>()(int(tensor.dtype()));
+        for (size_t i = 0; i < tensor.fields_count(); ++i) {
+            auto field = tensor.field(i);
+            for (auto dim : field.sizes()) seed = hash_combine(seed, std::hash<int>()(dim));
+            auto bytes = size_t(field.count()) * type_bytes(field.dtype());
+            seed = hash_combine(seed, std::hash<std::string>()(
+                    std::string(field.data<char>(), bytes)));
+        }
+        return seed;
+    }
+
+    static bool equal_tensor(const Tensor &lhs, const Tensor &rhs) {
+        if (lhs.fields_count() != rhs.fields_count()) return false;
+        for (size_t i = 0; i < lhs.fields_count(); ++i) {
+            auto lhs_field = lhs.field(i);
+            auto rhs_field = rhs.field(i);
+            if (lhs_field.dtype() != rhs_field.dtype()) return false;
+            if (lhs_field.sizes() != rhs_field.sizes()) return false;
+            auto bytes = size_t(lhs_field.count()) * type_bytes(lhs_field.dtype());
+            if (std::memcmp(lhs_field.data(), rhs_field.data(), bytes) != 0) return false;
+        }
+        return true;
+    }
+
+    /**
+     * params except name, which do not change computation
+     */
+    static bool equal_params(const Bubble &lhs, const Bubble &rhs) {
+        auto &lhs_params = lhs.params();
+        auto &rhs_params = rhs.params();
+        if (lhs_params.size() != rhs_params.size()) return false;
+        for (auto &param : lhs_params) {
+            if (param.first == Bubble::RetentionParam::name) continue;
+            auto it = rhs_params.find(param.first);
+            if (it == rhs_params.end()) return false;
+            if (!equal_tensor(param.second, it->second)) return false;
+        }
+        return true;
+    }
+
+    static size_t hash_node(const Bubble &bubble, const std::vector<Node> &inputs) {
+        size_t seed = std::hash<std::string>()(bubble.op());
+        for (auto &input : inputs) seed = hash_combine(seed, std::hash<Node>()(input));
+        // params is unordered, so combine them commutatively
+        size_t params_seed = 0;
+        for (auto &param : bubble.params()) {
+            if (param.first == Bubble::RetentionParam::name) continue;
+            params_seed += hash_combine(std::hash<std::string>()(param.first), hash_tensor(param.second));
+        }
+        return hash_combine(seed, params_seed);
+    }
+
+    class Simplifier {
+    public:
+        explicit Simplifier(const std::vector<Node> &outputs)
+                : m_outputs(outputs.begin(), outputs.end()) {}
+
+        Node simplify(const Node &node) {
+            auto ready_it = m_ready.find(node);
+            if (ready_it != m_ready.end()) return ready_it->second;
+
+            std::vector<Node> inputs;
+            for (auto &input : node.inputs()) {
+                inputs.emplace_back(simplify(input));
+            }
+
+            auto &bubble = node.bubble();
+            auto is_input = bubble.op() == Bubble::Parameter || bubble.op() == Bubble::Variable;
+            auto is_output = m_outputs.find(node) != m_outputs.end();
+
+            size_t hash = 0;
+            if (!is_input) {
+                hash = hash_node(bubble, inputs);
+                auto &bucket = m_buckets[hash];
+                for (auto &same : bucket) {
+                    if (same.bubble().op() != bubble.op()) continue;
+                    if (same.inputs() != inputs) continue;
+                    if (!equal_params(same.bubble(), bubble)) continue;
+                    // output node keep its own copy, but others can read it
+                    if (is_output) break;
+                    TS_LOG_DEBUG << "Merge node " << node.str() << " into " << same.str();
+                    ++merged;
+                    m_ready.insert(std::make_pair(node, same));
+                    return same;
+                }
+            }
+
+            auto simplified = bubble::bubble(bubble);
+            Node::Link(simplified, inputs);
+            if (!is_input) m_buckets[hash].push_back(simplified);
+            m_ready.insert(std::make_pair(node, simplified));
+            return simplified;
+        }
+
+        size_t merged = 0;
+
+    private:
+        std::unordered_set<Node> m_outputs;
+        std::unordered_map<Node, Node> m_ready;
+        std::unordered_map<size_t, std::vector<Node>> m_buckets;
+    };
+
+    Module::shared SimplifyTranslatorOption::translate(const ComputingDevice &device,
+                                                       Module::shared module) const {
+        Graph graph;
+        ctx::bind<Graph> _bind_graph(graph);
+
+        Simplifier simplifier(module->outputs());
+
+        std::vector<Node> outputs;
+        for (auto &output : module->outputs()) {
+            outputs.emplace_back(simplifier.simplify(output));
+        }
+
+        // keep order of inputs
+        std::vector<Node> inputs;
+        for (auto &input : module->inputs()) {
+            inputs.emplace_back(simplifier.simplify(input));
+        }
+
+        size_t original_count = 0;
+        for (auto &g : module->graphs()) {
+            original_count += g.nodes().size();
+        }
+        auto simplified_count = graph.nodes().size();
+        auto dead = original_count - std::min(original_count, simplified_count + simplifier.merged);
+
+        auto simplified_module = Module::Load(graph, outputs);
+        simplified_module->sort_inputs(inputs);
+
+        if (dead || simplifier.merged) {
+            TS_LOG_INFO << "Simplify module from " << original_count << " to " << simplified_count << " node(s): "
+                        << "removed " << dead << " unreachable node(s), "
+                        << "merged " << simplifier.merged << " duplicate node(s)";
+        }
+
+        return simplified_module;
+    }
+}
@@ -0,0 +1,303 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "compiler/option/transpose_translator_option.h"
+
+#include "backend/name.h"
+#include "backend/base/base_fused_elementwise.h"
+#include "core/tensor_builder.h"
+#include "module/menu.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ts {
+    static bool static_permute(const Node &node, std::vector<int32_t> &permute) {
+        auto &bubble = node.bubble();
+        if (bubble.op() != name::layer::transpose()) return false;
+        if (!bubble.has(name::permute)) return false;
+        if (node.inputs().size() != 1) return false;
+        auto permute_tensor = tensor::cast(INT32, bubble.get(name::permute));
+        auto data = permute_tensor.data<int32_t>();
+        permute = std::vector<int32_t>(data, data + permute_tensor.count());
+        std::vector<bool> flag(permute.size(), false);
+        for (auto dim : permute) {
+            if (dim < 0 || size_t(dim) >= permute.size() || flag[dim]) return false;
+            flag[dim] = true;
+        }
+        return true;
+    }
+
+    static bool static_shuffle(const Node &node, int &dim, std::vector<int32_t> &shuffle) {
+        auto &bubble = node.bubble();
+        if (bubble.op() != name::layer::dimshuffle()) return false;
+        if (node.inputs().size() != 1) return false;
+        dim = tensor::to_int(bubble.get(name::dim));
+        auto shuffle_tensor = tensor::cast(INT32, bubble.get(name::shuffle));
+        auto data = shuffle_tensor.data<int32_t>();
+        shuffle = std::vector<int32_t>(data, data + shuffle_tensor.count());
+        return true;
+    }
+
+    static bool is_identity(const std::vector<int32_t> &permute) {
+        for (size_t i = 0; i < permute.size(); ++i) {
+            if (permute[i] != int32_t(i)) return false;
+        }
+        return true;
+    }
+
+    static bool is_const(const Node &node) {
+        return node.bubble().op() == Bubble::Const && !node.bubble().has(name::device);
+    }
+
+    static bool is_scalar_const(const Node &node) {
+        if (!is_const(node)) return false;
+        auto &value = node.bubble().get(name::value);
+        return value.fields_count() == 1 && value.count() == 1 && value.dims() <= 1;
+    }
+
+    /**
+     * @return rank of node's output, -1 if unknown before running
+     */
+    static int known_rank(const Node &node) {
+        auto &bubble = node.bubble();
+        std::vector<int32_t> permute;
+        if (static_permute(node, permute)) return int(permute.size());
+        if (is_const(node)) {
+            auto &value = bubble.get(name::value);
+            return value.fields_count() == 1 ? int(value.dims()) : -1;
+        }
+        if (bubble.op() == Bubble::Parameter && !bubble.shape().empty()) return int(bubble.shape().size());
+        auto &op = bubble.op();
+        if (op == name::layer::conv2d() || op == name::layer::conv2d_v2() ||
+            op == name::layer::depthwise_conv2d() || op == name::layer::depthwise_conv2d_v2() ||
+            op == name::layer::pooling2d() || op == name::layer::pooling2d_v2()) {
+            return 4;
+        }
+        // elementwise output is broadcast of inputs
+        auto opcode = base::FusedElementWise::Encode(op);
+        if (opcode < 0) return -1;
+        int rank = -1;
+        for (auto &input : node.inputs()) {
+            auto input_rank = known_rank(input);
+            if (input_rank < 0) return -1;
+            rank = std::max(rank, input_rank);
+        }
+        return rank;
+    }
+
+    /**
+     * check consumers still reading node
+     */
+    static bool single_consumer(const Node &node) {
+        size_t count = 0;
+        for (auto &output : node.outputs()) {
+            if (output.expired()) continue;
+            auto inputs = output.inputs();
+            count += std::count(inputs.begin(), inputs.end(), node);
+        }
+        return count == 1;
+    }
+
+    /**
+     * transpose on host, x's shape is prefixed with 1 to size of permute
+     */
+    static Tensor transpose_tensor(const Tensor &x, const std::vector<int32_t> &permute) {
+        auto cpu_x = x.view(MemoryDevice(CPU));
+        auto dims = permute.size();
+
+        auto in_shape = cpu_x.sizes();
+        Shape ones(dims - in_shape.size(), 1);
+        in_shape.insert(in_shape.begin(), ones.begin(), ones.end());
+        std::vector<int> in_strides(dims);
+        int stride = 1;
+        for (size_t i = dims; i-- > 0;) {
+            in_strides[i] = stride;
+            stride *= in_shape[i];
+        }
+        Shape out_shape(dims);
+        for (size_t i = 0; i < dims; ++i) {
+            out_shape[i] = in_shape[permute[i]];
+        }
+
+        Tensor y(cpu_x.dtype(), out_shape);
+        auto width = size_t(type_bytes(cpu_x.dtype()));
+        auto src = cpu_x.data<char>();
+        auto dst = y.data<char>();
+        std::vector<int> index(dims, 0);
+        auto count = y.count();
+        for (int i = 0; i < count; ++i) {
+            int offset = 0;
+            for (size_t j = 0; j < dims; ++j) {
+                offset += index[j] * in_strides[permute[j]];
+            }
+            std::memcpy(dst + i * width, src + offset * width, width);
+            for (size_t j = dims; j-- > 0;) {
+                if (++index[j] < out_shape[j]) break;
+                index[j] = 0;
+            }
+        }
+        return y;
+    }
+
+    class TransposeFolder {
+    public:
+        explicit TransposeFolder(const std::vector<Node> &outputs)
+                : m_outputs(outputs.begin(), outputs.end()) {}
+
+        Node fold(const Node &node) {
+            auto ready_it = m_ready.find(node);
+            if (ready_it != m_ready.end()) return ready_it->second;
+
+            std::vector<Node> inputs;
+            for (auto &input : node.inputs()) {
+                inputs.emplace_back(fold(input));
+            }
+
+            auto is_output = m_outputs.find(node) != m_outputs.end();
+
+            auto folded = node;
+            if (!fold_transpose(node, inputs, is_output, folded) &&
+                !fold_dimshuffle(node, inputs, folded) &&
+                (is_output || !sink_elementwise(node, inputs, folded))) {
+                folded = bubble::bubble(node.bubble());
+                Node::Link(folded, inputs);
+            }
+
+            m_ready.insert(std::make_pair(node, folded));
+            return folded;
+        }
+
+        size_t composed = 0;
+        size_t removed = 0;
+        size_t computed = 0;
+        size_t sunk = 0;
+
+    private:
+        bool fold_transpose(const Node &node, const std::vector<Node> &inputs, bool is_output, Node &folded) {
+            std::vector<int32_t> permute;
+            if (!static_permute(node, permute)) return false;
+
+            auto x = inputs[0];
+            bool changed = false;
+            std::vector<int32_t> inner;
+            if (static_permute(x, inner) && inner.size() == permute.size()) {
+                for (auto &dim : permute) dim = inner[dim];
+                x = x.inputs()[0];
+                changed = true;
+                ++composed;
+            }
+
+            // input with less dims is prefixed with 1, so identity may still change rank
+            if (is_identity(permute) && !is_output && known_rank(x) == int(permute.size())) {
+                TS_LOG_DEBUG << "Remove identity " << node.str();
+                ++removed;
+                folded = x;
+                return true;
+            }
+
+            if (is_const(x)) {
+                auto &value = x.bubble().get(name::value);
+                if (value.fields_count() == 1 && size_t(value.dims()) <= permute.size()) {
+                    ++computed;
+                    folded = bubble::data(node.bubble().name(), transpose_tensor(value, permute));
+                    return true;
+                }
+            }
+
+            if (!changed) return false;
+
+            folded = bubble::bubble(node.bubble());
+            folded.bubble().set(name::permute, tensor::from(permute));
+            Node::Link(folded, {x});
+            return true;
+        }
+
+        bool fold_dimshuffle(const Node &node, const std::vector<Node> &inputs, Node &folded) {
+            int dim, inner_dim;
+            std::vector<int32_t> shuffle, inner;
+            if (!static_shuffle(node, dim, shuffle)) return false;
+            if (!static_shuffle(inputs[0], inner_dim, inner) || inner_dim != dim) return false;
+            for (auto &i : shuffle) {
+                if (i < 0 || size_t(i) >= inner.size()) return false;
+                i = inner[i];
+            }
+            ++composed;
+            folded = bubble::bubble(node.bubble());
+            folded.bubble().set(name::shuffle, tensor::from(shuffle));
+            Node::Link(folded, {inputs[0].inputs()[0]});
+            return true;
+        }
+
+        /**
+         * op(transpose(a), transpose(b)) to transpose(op(a, b)), if transposes have same permute
+         */
+        bool sink_elementwise(const Node &node, const std::vector<Node> &inputs, Node &folded) {
+            auto opcode = base::FusedElementWise::Encode(node.bubble().op());
+            if (opcode < 0) return false;
+            if (inputs.size() != (base::FusedElementWise::IsUnary(opcode) ? 1U : 2U)) return false;
+
+            auto raw_inputs = node.inputs();
+            std::vector<int32_t> permute;
+            std::vector<Node> sunk_inputs;
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                std::vector<int32_t> input_permute;
+                if (static_permute(inputs[i], input_permute) && single_consumer(raw_inputs[i])) {
+                    if (!permute.empty() && input_permute != permute) return false;
+                    permute = input_permute;
+                    sunk_inputs.emplace_back(inputs[i].inputs()[0]);
+                } else if (is_scalar_const(inputs[i])) {
+                    sunk_inputs.emplace_back(inputs[i]);
+                } else {
+                    return false;
+                }
+            }
+            if (permute.empty()) return false;
+
+            ++sunk;
+            auto op = bubble::bubble(node.bubble());
+            Node::Link(op, sunk_inputs);
+            folded = bubble::op(node.bubble().name() + "_transpose", name::layer::transpose(), {op});
+            folded.bubble().set(name::permute, tensor::from(permute));
+            return true;
+        }
+
+        std::unordered_set<Node> m_outputs;
+        std::unordered_map<Node, Node> m_ready;
+    };
+
+    Module::shared TransposeTranslatorOption::translate(const ComputingDevice &device,
+                                                        Module::shared module) const {
+        Graph graph;
+        ctx::bind<Graph> _bind_graph(graph);
+
+        TransposeFolder folder(module->outputs());
+
+        std::vector<Node> outputs;
+        for (auto &output : module->outputs()) {
+            outputs.emplace_back(folder.fold(output));
+        }
+
+        // keep order of inputs
+        std::vector<Node> inputs;
+        for (auto &input : module->inputs()) {
+            inputs.emplace_back(folder.fold(input));
+        }
+
+        auto folded_module = Module::Load(graph, outputs);
+        folded_module->sort_inputs(inputs);
+
+        if (folder.composed || folder.removed || folder.computed || folder.sunk) {
+            TS_LOG_INFO << "Fold transpose: "
+                        << "composed " << folder.composed << ", "
+                        << "removed " << folder.removed << " identity, "
+                        << "computed " << folder.computed << " const, "
+                        << "sunk " << folder.sunk << " elementwise node(s)";
+        }
+
+        return folded_module;
+    }
+}
@@ -91,6 +91,10 @@ namespace ts {
         if (bubble.has(name::padding_value)) {
             zipped_node.bubble().set(name::padding_value, padding_val_tensor);
         }
+        // keep fused epilogue
+        for (auto &param : {name::bias, name::activation, name::max, name::scale, name::slope}) {
+            if (bubble.has(param)) zipped_node.bubble().set(param, bubble.get(param));
+        }
 
         return true;
     }
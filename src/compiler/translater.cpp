@@ -8,6 +8,10 @@
 
 #include "compiler/option/fp16_translator_option.h"
 #include "compiler/option/pack_translator_option.h"
+#include "compiler/option/elementwise_translator_option.h"
+#include "compiler/option/autotune_translator_option.h"
+#include "compiler/option/simplify_translator_option.h"
+#include "compiler/option/transpose_translator_option.h"
 
 #include "module/menu.h"
 
@@ -67,6 +71,9 @@ namespace ts {
         //auto temp_graph = ctx::get<Graph>();
 
         auto options_v2 = GetFullTranslateV2Options();
+        for (auto &option : m_options_v2) {
+            options_v2.push_back(option);
+        }
         for (auto &option : options_v2) {
             new_module = option->translate(m_device, new_module);
         }
@@ -91,7 +98,14 @@ namespace ts {
         //std::cout << "+++++++++++++++++ translated graph ++++++++++++++++++++++" << std::endl;
         //plot_graph(std::cout, traslated_nodes);
 
+        // keep order of inputs
+        std::vector<Node> translated_inputs;
+        for (auto &node : new_module->inputs()) {
+            translated_inputs.emplace_back(translate_node(node, ready_map, m_device, options, m_params, false));
+        }
+
         new_module = Module::Load(temp_graph, traslated_nodes);
+        new_module->sort_inputs(translated_inputs);
         return new_module;
     }
 
@@ -101,11 +115,33 @@ namespace ts {
         ArgParser parser;
         parser.add({"--float16", "-fp16"}, {"--no-float16", "-no-fp16"}, false);
         parser.add({ "--pack" }, {"--no-pack"}, true);
+        parser.add({"--fuse-elementwise"}, {"--no-fuse-elementwise"}, false);
+        parser.add({"--autotune"}, {"--no-autotune"}, false);
+        parser.add({"--simplify"}, {"--no-simplify"}, false);
+        parser.add({"--fold-transpose"}, {"--no-fold-transpose"}, false);
         parser.parse(params);
+        if (parser.get("--fold-transpose")) {
+            m_options_v2.push_back(new TransposeTranslatorOption);
+        }
+        if (parser.get("--simplify")) {
+            m_options_v2.push_back(new SimplifyTranslatorOption);
+        }
         if (parser.get("--float16")) {
              TS_LOG_STATUS << "Compiling with --float16";
             m_options.push_back(new Fp16TranslatorOption);
         }
+        if (parser.get("--fuse-elementwise")) {
+            TS_LOG_STATUS << "Compiling with --fuse-elementwise";
+            m_options.push_back(new ElementWiseTranslatorOption);
+        }
+        if (parser.get("--autotune")) {
+            auto cache_path = AutotuneTranslatorOption::CachePath(params);
+            if (cache_path.empty()) {
+                TS_LOG_ERROR << "Compiling with --autotune needs --autotune-cache=<path>" << eject;
+            }
+            TS_LOG_STATUS << "Compiling with --autotune, cache: " << cache_path;
+            m_options.push_back(new AutotuneTranslatorOption(cache_path));
+        }
 #ifndef TS_USE_CBLAS
         if (parser.get("--pack")) {
             TS_LOG_STATUS << "Compiling with --pack";
@@ -119,5 +155,9 @@ namespace ts {
             delete option;
         }
         m_options.clear();
+        for (auto &option : m_options_v2) {
+            delete option;
+        }
+        m_options_v2.clear();
     }
 }
\ No newline at end of file
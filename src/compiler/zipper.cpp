@@ -56,6 +56,19 @@ namespace ts {
             Node::Link(zipped_node, zipped_inputs);
         }
 
+        /**
+         * zipped inputs may expose new pattern to this node
+         */
+        if (zipped_node != node) {
+            Node rezipped_node = zipped_node;
+            for (auto &option : options) {
+                if (option->zip(device, zipped_node, rezipped_node)) {
+                    zipped_node = zip_node(rezipped_node, ready_map, device, options);
+                    break;
+                }
+            }
+        }
+
         ready_map.insert(std::make_pair(node, zipped_node));
 
         return zipped_node;
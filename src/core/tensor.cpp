@@ -330,6 +330,8 @@ namespace ts {
             memcpy(cpu_memory, memory);
         }
         // 2. write memory
+        auto aligned = dynamic_cast<AlignedStreamWriter *>(&stream);
+        if (aligned) writen_size += aligned->align();
         writen_size += binio::write<char>(stream, cpu_memory.data<char>(), size_t(proto.count()) * proto.type_bytes());
         return writen_size;
     }
@@ -359,7 +361,14 @@ namespace ts {
         proto = Tensor::Prototype(dtype, shape);
 
         // 2. read memory
-        memory = controller->alloc(size_t(proto.count()) * proto.type_bytes());
+        auto size = size_t(proto.count()) * proto.type_bytes();
+        auto aligned = dynamic_cast<AlignedStreamReader *>(&stream);
+        if (aligned) {
+            read_size += aligned->align();
+            // use memory in mapped file, if memory is aligned
+            if (aligned->view(size, memory)) return read_size + size;
+        }
+        memory = controller->alloc(size);
         read_size += binio::read<char>(stream, memory.data<char>(), memory.size());
         return read_size;
     }
@@ -17,7 +17,8 @@ namespace ts {
         template<typename T>
         static void cpu_conv2d_nchw_compute_run(const Tensor &x, const Padding2D &padding, float padding_value,
                                            const Tensor &w, const Stride2D &stride, const Dilation2D &dilation,
-                                           Tensor &out, Stack &stack, bool kernel_packed) {
+                                           Tensor &out, Stack &stack, bool kernel_packed,
+                                           const Epilogue<T> &epilogue) {
             auto weight_shape = w.sizes();
             auto output_shape = out.sizes();
             auto x_shape = x.sizes();
@@ -75,6 +76,7 @@ namespace ts {
                 const T *pweight = w.data<T>();
                 cblas::math<T>::gemm(ts::blas::NoTrans, ts::blas::NoTrans, weight_shape[0], conv_out_spatial_dim,
                                      kernel_dims, 1.0, pweight, col_buffer, 0, poutput);
+                if (!epilogue.empty()) epilogue.apply(poutput, conv_out_spatial_dim, 0, weight_shape[0], conv_out_spatial_dim);
 #else
                 packed_col = stack.make(x.dtype(), packed_shape, MemoryDevice(CPU));
                 Tensor packed_tensor;
@@ -83,7 +85,8 @@ namespace ts {
                     packed_tensor = stack.make(w.dtype(), w.sizes(), MemoryDevice(CPU));
                 }
                 cpu::math<T, T>::gemm(weight_shape[0], conv_out_spatial_dim, kernel_dims, (T)1, w.data<T>(), packed_tensor.data<T>(),
-                                      col_buffer, packed_col.data<T>(), T(0), poutput, kernel_need_pack, true);
+                                      col_buffer, packed_col.data<T>(), T(0), poutput, kernel_need_pack, true,
+                                      epilogue.empty() ? nullptr : &epilogue);
 
                 //Tensor kernel_packed = stack.make(w.dtype(), w.sizes(), MemoryDevice(CPU));
                 //Conv2dAlgorithm<T>::kernel_pack8x8(w, kernel_packed);
@@ -101,13 +104,20 @@ namespace ts {
         void Conv2DCore::conv2d(const Tensor &x, const Padding2D &padding, float padding_value, const Tensor &w,
                             const Stride2D &stride, const Dilation2D &dilation, Conv2DFormat format, Tensor &out,
                             Stack &stack, bool kernel_packed) {
+            conv2d(x, padding, padding_value, w, stride, dilation, format, out, stack, kernel_packed, base::Epilogue());
+        }
+
+        void Conv2DCore::conv2d(const Tensor &x, const Padding2D &padding, float padding_value, const Tensor &w,
+                            const Stride2D &stride, const Dilation2D &dilation, Conv2DFormat format, Tensor &out,
+                            Stack &stack, bool kernel_packed, const base::Epilogue &epilogue) {
             if (format != FORMAT_NCHW) {
                 TS_LOG_ERROR << "Conv2D only support NCHW" << eject;
             }
             DTYPE dtype = out.dtype();
             switch (dtype) {
 #define DECLARE_COMPUTE_RUN(DTYPE, TYPE) \
-        case DTYPE: { cpu_conv2d_nchw_compute_run<TYPE>(x, padding, padding_value, w, stride, dilation, out, stack, kernel_packed); break; }
+        case DTYPE: { cpu_conv2d_nchw_compute_run<TYPE>(x, padding, padding_value, w, stride, dilation, out, stack, kernel_packed, \
+                Epilogue<TYPE>(epilogue, 0)); break; }
                 DECLARE_COMPUTE_RUN(FLOAT32, float);
                 DECLARE_COMPUTE_RUN(FLOAT64, double);
 #undef DECLARE_COMPUTE_RUN
@@ -9,6 +9,7 @@
 #include "module/bubble.h"
 #include "core/tensor_builder.h"
 #include "utils/need.h"
+#include "backend/base/base_epilogue.h"
 
 namespace ts {
     namespace cpu {
@@ -20,6 +21,7 @@ namespace ts {
             field(name::dilation, OPTIONAL);
             field(name::typo::dialations, OPTIONAL);
             field(name::kernel_packed, OPTIONAL, tensor::from<bool>(false));
+            base::Epilogue::Field(*this);
         }
 
         void Conv2DV2::init() {
@@ -39,6 +41,8 @@ namespace ts {
                 }
             }
 
+            base::Epilogue::Copy(*this, *m_op_conv2d);
+
             m_op_conv2d->set(name::format, get(name::format));
             m_op_conv2d->set(name::padding_value, get(name::padding_value));
             m_op_conv2d->set(name::stride, get(name::stride));
@@ -29,13 +29,14 @@ namespace ts {
                                             float padding_value,
                                             const Tensor &w,
                                             Tensor &out,
-                                            bool kernel_transformed) {
-
+                                            bool kernel_transformed,
+                                            const Epilogue<T> &epilogue) {
+            auto fused = epilogue.empty() ? nullptr : &epilogue;
             if (winograd_model == F2X2_3X3){
-                return Conv2dWinogradAlgorithm<T>::winograd_f23(x, padding, padding_value, w, out, kernel_transformed);
+                return Conv2dWinogradAlgorithm<T>::winograd_f23(x, padding, padding_value, w, out, kernel_transformed, fused);
             }
             else
-                return Conv2dWinogradAlgorithm<T>::winograd_f63(x, padding, padding_value, w, out, kernel_transformed);
+                return Conv2dWinogradAlgorithm<T>::winograd_f63(x, padding, padding_value, w, out, kernel_transformed, fused);
 
             //if (padding.bottom != 0 || padding.top != 0 || padding.left != 0 || padding.right != 0) {
             //    auto pad_operator = OperatorCreator::Query(CPU, name::layer::pad())();
@@ -89,13 +90,26 @@ namespace ts {
                                              Conv2DFormat format,
                                              Tensor &out,
                                              bool kernel_transformed) {
+            conv2d_winograd(x, winograd_mode, padding, padding_value, w, format, out, kernel_transformed, base::Epilogue());
+        }
+
+        void Conv2DWinograd::conv2d_winograd(const Tensor &x,
+                                             WinogradConv2DMode winograd_mode,
+                                             const Padding2D &padding,
+                                             float padding_value,
+                                             const Tensor &w,
+                                             Conv2DFormat format,
+                                             Tensor &out,
+                                             bool kernel_transformed,
+                                             const base::Epilogue &epilogue) {
             if (format != FORMAT_NCHW) {
                 TS_LOG_ERROR << "Conv2D_Winograd only support NCHW" << eject;
             }
             DTYPE dtype = out.dtype();
             switch (dtype) {
 #define DECLARE_COMPUTE_RUN(DTYPE, TYPE) \
-        case DTYPE: { conv2d_winograd_forward<TYPE>(x, winograd_mode, padding, padding_value, w, out, kernel_transformed); break; }
+        case DTYPE: { conv2d_winograd_forward<TYPE>(x, winograd_mode, padding, padding_value, w, out, kernel_transformed, \
+                Epilogue<TYPE>(epilogue, 0)); break; }
                 DECLARE_COMPUTE_RUN(FLOAT32, float);
 //                DECLARE_COMPUTE_RUN(FLOAT64, double);
 #undef DECLARE_COMPUTE_RUN
@@ -9,6 +9,7 @@
 #include "core/device_context.h"
 #include "global/operator_factory.h"
 #include "module/bubble.h"
+#include "backend/base/base_epilogue.h"
 
 namespace ts{
     namespace cpu{
@@ -17,6 +18,8 @@ namespace ts{
             field(name::format, REQUIRED);
             field(name::padding_value, OPTIONAL, tensor::from(0.0f));
             field(name::kernel_winograd_transformed, OPTIONAL, tensor::from<bool>(false));
+            field(name::winograd_mode, OPTIONAL);
+            base::Epilogue::Field(*this);
         }
 
         void Conv2DWinogradV2::init() {
@@ -34,9 +37,14 @@ namespace ts{
                 }
             }
 
+            base::Epilogue::Copy(*this, *m_op_conv2d_winograd);
+
             m_op_conv2d_winograd->set(name::format, get(name::format));
             m_op_conv2d_winograd->set(name::padding_value, get(name::padding_value));
             m_op_conv2d_winograd->set(name::kernel_winograd_transformed, get(name::kernel_winograd_transformed));
+            if (has(name::winograd_mode)) {
+                m_op_conv2d_winograd->set(name::winograd_mode, get(name::winograd_mode));
+            }
         }
 
         static bool is_int_equal(const Tensor &lhs, const Tensor &rhs) {
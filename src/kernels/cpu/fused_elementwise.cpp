@@ -0,0 +1,187 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "kernels/cpu/fused_elementwise.h"
+
+#include "backend/name.h"
+#include "global/operator_factory.h"
+#include "core/tensor_iterator.h"
+
+#include <cmath>
+#include <algorithm>
+
+#ifdef TS_USE_OPENMP
+#include "kernels/common/openmp.h"
+#endif
+
+namespace ts {
+    namespace cpu {
+        using Step = base::FusedElementWise::Step;
+
+        /**
+         * values of each step are computed block by block, so intermediate values stay in cache
+         */
+        static const int FUSED_BLOCK_SIZE = 1024;
+
+        template<typename T>
+        static inline void fused_step(int opcode, const T *a, const T *b, T *c, int n) {
+            switch (opcode) {
+                default:
+                    break;
+                case base::FusedElementWise::ADD:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] + b[i];
+                    break;
+                case base::FusedElementWise::SUB:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] - b[i];
+                    break;
+                case base::FusedElementWise::MUL:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] * b[i];
+                    break;
+                case base::FusedElementWise::DIV:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] / b[i];
+                    break;
+                case base::FusedElementWise::MAXIMUM:
+                    for (int i = 0; i < n; ++i) c[i] = std::max(a[i], b[i]);
+                    break;
+                case base::FusedElementWise::RELU:
+                    for (int i = 0; i < n; ++i) c[i] = std::max(a[i], T(0));
+                    break;
+                case base::FusedElementWise::SIGMOID:
+                    for (int i = 0; i < n; ++i) c[i] = T(1 / (1 + std::exp(-a[i])));
+                    break;
+                case base::FusedElementWise::TANH:
+                    for (int i = 0; i < n; ++i) c[i] = T(std::tanh(a[i]));
+                    break;
+                case base::FusedElementWise::EXP:
+                    for (int i = 0; i < n; ++i) c[i] = T(std::exp(a[i]));
+                    break;
+                case base::FusedElementWise::SQRT:
+                    for (int i = 0; i < n; ++i) c[i] = T(std::sqrt(a[i]));
+                    break;
+                case base::FusedElementWise::RSQRT:
+                    for (int i = 0; i < n; ++i) c[i] = T(1 / std::sqrt(a[i]));
+                    break;
+                case base::FusedElementWise::SQUARE:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] * a[i];
+                    break;
+                case base::FusedElementWise::ABS:
+                    for (int i = 0; i < n; ++i) c[i] = a[i] < 0 ? T(-a[i]) : a[i];
+                    break;
+            }
+        }
+
+        template<typename T>
+        static void cpu_broadcast_to(const Tensor &x, Tensor &out) {
+            HypeShape x_hype(x.sizes());
+            ShapeIterator out_iterator(out.sizes());
+
+            auto px = x.data<T>();
+            auto pout = out.data<T>();
+
+            auto count = out.count();
+            for (int i = 0; i < count; ++i) {
+                auto coordinate = out_iterator.coordinate();
+                for (size_t j = 0; j < coordinate.size(); ++j) {
+                    coordinate[j] %= x_hype.shape(j);
+                }
+                pout[i] = px[x_hype.to_index(coordinate)];
+                ++out_iterator;
+            }
+        }
+
+        template<typename T>
+        static void cpu_fused_elementwise_compute_run(const std::vector<Tensor> &inputs,
+                                                      const std::vector<Step> &steps,
+                                                      Tensor &out) {
+            const int block = FUSED_BLOCK_SIZE;
+            auto count = out.count();
+            auto input_number = int(inputs.size());
+            auto step_number = int(steps.size());
+
+            // scalar inputs are expanded to one block, others are read in place
+            std::vector<Tensor> broadcast_inputs(input_number);
+            std::vector<T> scalar_blocks;
+            std::vector<const T *> input_data(input_number, nullptr);
+            std::vector<bool> input_scalar(input_number, false);
+            for (int i = 0; i < input_number; ++i) {
+                auto &x = inputs[i];
+                if (x.count() == count) {
+                    input_data[i] = x.data<T>();
+                } else if (x.count() == 1) {
+                    if (scalar_blocks.empty()) scalar_blocks.resize(size_t(input_number) * block);
+                    std::fill_n(scalar_blocks.data() + size_t(i) * block, block, x.data<T>()[0]);
+                    input_data[i] = scalar_blocks.data() + size_t(i) * block;
+                    input_scalar[i] = true;
+                } else {
+                    broadcast_inputs[i] = Tensor(out.dtype(), out.sizes());
+                    cpu_broadcast_to<T>(x, broadcast_inputs[i]);
+                    input_data[i] = broadcast_inputs[i].data<T>();
+                }
+            }
+
+            auto out_data = out.data<T>();
+            auto blocks = (count + block - 1) / block;
+
+            int threads = 1;
+#ifdef TS_USE_OPENMP
+            threads = std::max(1, std::min(openmp_threads(), blocks));
+#endif
+            // each thread keeps intermediate values of steps except the last one, which goes to out
+            auto temp_size = size_t(step_number - 1) * block;
+            std::vector<T> temp(std::max<size_t>(1, temp_size * threads));
+
+#ifdef TS_USE_OPENMP
+#pragma omp parallel for num_threads(threads)
+#endif
+            for (int b = 0; b < blocks; ++b) {
+                auto begin = b * block;
+                auto n = std::min(block, count - begin);
+#ifdef TS_USE_OPENMP
+                auto thread_temp = temp.data() + temp_size * openmp_thread_id();
+#else
+                auto thread_temp = temp.data();
+#endif
+                auto reg = [&](int r) -> const T * {
+                    if (r < input_number) return input_scalar[r] ? input_data[r] : input_data[r] + begin;
+                    return thread_temp + size_t(r - input_number) * block;
+                };
+                for (int s = 0; s < step_number; ++s) {
+                    auto &step = steps[s];
+                    T *c = s == step_number - 1 ? out_data + begin : thread_temp + size_t(s) * block;
+                    const T *rhs = base::FusedElementWise::IsUnary(step.opcode) ? nullptr : reg(step.rhs);
+                    fused_step<T>(step.opcode, reg(step.lhs), rhs, c, n);
+                }
+            }
+        }
+
+        void FusedElementWise::fused_elementwise(const std::vector<Tensor> &inputs, const std::vector<Step> &steps,
+                                                 Tensor &out) {
+            // Notice: the all tensor' memory device are CPU, as given in running_memory_device
+            DTYPE dtype = out.dtype();
+            switch (dtype) {
+#define DECLARE_COMPUTE_RUN(DTYPE, TYPE) \
+        case DTYPE: { cpu_fused_elementwise_compute_run<TYPE>(inputs, steps, out); break; }
+                DECLARE_COMPUTE_RUN(INT8, int8_t);
+                DECLARE_COMPUTE_RUN(UINT8, uint8_t);
+                DECLARE_COMPUTE_RUN(INT16, int16_t);
+                DECLARE_COMPUTE_RUN(UINT16, uint16_t);
+                DECLARE_COMPUTE_RUN(INT32, int32_t);
+                DECLARE_COMPUTE_RUN(UINT32, uint32_t);
+                DECLARE_COMPUTE_RUN(INT64, int64_t);
+                DECLARE_COMPUTE_RUN(UINT64, uint64_t);
+                DECLARE_COMPUTE_RUN(FLOAT32, float);
+                DECLARE_COMPUTE_RUN(FLOAT64, double);
+#undef DECLARE_COMPUTE_RUN
+                default: {
+                    TS_LOG_ERROR << this->op() << " not support data type(" << dtype << "): " << type_str(dtype) << eject;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+using namespace ts;
+using namespace cpu;
+TS_REGISTER_OPERATOR(FusedElementWise, CPU, name::layer::fused_elementwise())
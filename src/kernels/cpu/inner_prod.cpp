@@ -16,7 +16,8 @@
 namespace ts {
     namespace cpu {
         template<typename T>
-        static void cpu_inner_prod_compute_run(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed) {
+        static void cpu_inner_prod_compute_run(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed,
+                                               const Epilogue<T> &epilogue) {
             const Shape &lhs_shape = lhs.sizes();
             const Shape &rhs_shape = rhs.sizes();
             // const Shape &out_shape = out.sizes();
@@ -30,6 +31,7 @@ namespace ts {
             auto rhs_transpose = transpose ? blas::Trans : blas::NoTrans;
             cblas::math<T>::gemm(blas::NoTrans, rhs_transpose, lhs_shape[0], N, lhs_shape[1],
                                  (T) 1, psrc, pdot, (T) 0, pdst);
+            if (!epilogue.empty()) epilogue.apply(pdst, N, 0, lhs_shape[0], N);
 #else
             if (transpose && kernel_packed) {
                  TS_LOG_ERROR << "What a Terrible Failure: dealing transpose weights without transpose support, because supporting pack" << eject;
@@ -45,18 +47,25 @@ namespace ts {
             Tensor rhs_packed = stack.make(rhs.dtype(), rhs_shape, MemoryDevice(CPU));
             
             cpu::math<T, T>::gemm(lhs_shape[0], N, lhs_shape[1], (T)1, lhs.data<T>(), lhs_packed.data<T>(),
-                                  rhs_data, rhs_packed.data<T>(), T(0), pdst, true, !kernel_packed);
+                                  rhs_data, rhs_packed.data<T>(), T(0), pdst, true, !kernel_packed,
+                                  epilogue.empty() ? nullptr : &epilogue);
             //cpu::math<T, T>::gemm(blas::NoTrans, rhs_transpose, lhs_shape[0], N, lhs_shape[1],
             //                   (T) 1, psrc, pdot, (T) 0, pdst);
 #endif
         }
 
         void InnerProd::inner_prod(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed) {
+            inner_prod(lhs, rhs, transpose, out, stack, kernel_packed, base::Epilogue());
+        }
+
+        void InnerProd::inner_prod(const Tensor &lhs, const Tensor &rhs, bool transpose, Tensor &out, Stack &stack, bool kernel_packed,
+                                   const base::Epilogue &epilogue) {
             // Notice: the all tensor' memory device are CPU, as given in running_memory_device
             DTYPE dtype = out.dtype();
             switch (dtype) {
 #define DECLARE_COMPUTE_RUN(DTYPE, TYPE) \
-        case DTYPE: { cpu_inner_prod_compute_run<TYPE>(lhs, rhs, transpose, out, stack, kernel_packed); break; }
+        case DTYPE: { cpu_inner_prod_compute_run<TYPE>(lhs, rhs, transpose, out, stack, kernel_packed, \
+                Epilogue<TYPE>(epilogue, 1)); break; }
                 DECLARE_COMPUTE_RUN(FLOAT32, float);
                 DECLARE_COMPUTE_RUN(FLOAT64, double);
 #undef DECLARE_COMPUTE_RUN
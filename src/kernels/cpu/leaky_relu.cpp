@@ -94,4 +94,4 @@ namespace ts {
 
 using namespace ts;
 using namespace cpu;
-TS_REGISTER_OPERATOR(LeakyReLU, ts::CPU, "leaky_relu")
+TS_REGISTER_OPERATOR(LeakyReLU, ts::CPU, name::layer::leaky_relu())
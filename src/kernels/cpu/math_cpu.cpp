@@ -378,12 +378,14 @@ namespace ts {
         }
 
         template<typename T_IN, typename T_OUT>
-        inline void kernel_8x8(int M, int K, int N, T_IN alpha, const T_IN *A, const T_IN *B, T_IN beta, T_OUT *C, int ldc) {
-
+        inline void kernel_8x8(int M, int K, int N, T_IN alpha, const T_IN *A, const T_IN *B, T_IN beta, T_OUT *C, int ldc,
+                               const Epilogue<T_OUT> *epilogue) {
+            if (epilogue) epilogue->apply(C, ldc, 0, M, N);
         }
 
         template<>
-        inline void kernel_8x8<float, float>(int M, int K, int N, float alpha, const float *A, const float *B, float beta, float *C, int ldc) {
+        inline void kernel_8x8<float, float>(int M, int K, int N, float alpha, const float *A, const float *B, float beta, float *C, int ldc,
+                                             const Epilogue<float> *epilogue) {
             const float* p_A = A;
             const float* p_B = B;
             float* p_C = C;
@@ -609,6 +611,9 @@ namespace ts {
                     *output_row6++ = *(((float*)&sum_col.value) + 6);
                     *output_row7++ = *(((float*)&sum_col.value) + 7);
                 }
+
+                // rows are still in cache
+                if (epilogue) epilogue->apply(output_at, ldc, m, m + 8, N);
             }
 
 #ifdef TS_USE_OPENMP
@@ -696,12 +701,15 @@ namespace ts {
                     *output_row0 = sum0;
                     output_row0++;
                 }
+
+                if (epilogue) epilogue->apply(output_at, ldc, m, m + 1, N);
             }
         }
 
         template<typename T_IN, typename T_OUT>
         void math<T_IN, T_OUT>::gemm(int M, int N, int K, T_IN alpha, const T_IN *A, const T_IN *B,
-                                     T_IN beta, T_OUT *C, bool A_need_pack, bool B_need_pack) {
+                                     T_IN beta, T_OUT *C, bool A_need_pack, bool B_need_pack,
+                                     const Epilogue<T_OUT> *epilogue) {
             Tensor A_packed;
             Tensor B_packed;
             if (A_need_pack) {
@@ -710,12 +718,13 @@ namespace ts {
             if (B_need_pack) {
                 B_packed = Tensor(Tensor::InFlow::HOST, dtypeid<T_IN>::id, {int32_t(N * K),});
             }
-            self::gemm(M, N, K, alpha, A, A_packed.data<T_IN>(), B, B_packed.data<T_IN>(), beta, C, A_need_pack, B_need_pack);
+            self::gemm(M, N, K, alpha, A, A_packed.data<T_IN>(), B, B_packed.data<T_IN>(), beta, C, A_need_pack, B_need_pack, epilogue);
         }
 
         template<typename T_IN, typename T_OUT>
         void math<T_IN, T_OUT>::gemm(int M, int N, int K, T_IN alpha, const T_IN *A, T_IN *A_packed, const T_IN *B, T_IN *B_packed,
-                           T_IN beta, T_OUT *C, bool A_need_pack, bool B_need_pack) {
+                           T_IN beta, T_OUT *C, bool A_need_pack, bool B_need_pack,
+                           const Epilogue<T_OUT> *epilogue) {
 
             if (!ts::near(alpha, T_IN(1)) || !ts::near(beta, T_IN(0))) {
                 TS_LOG_ERROR << "alpha should be one and beta should be zero now!"<< eject;
@@ -729,16 +738,16 @@ namespace ts {
             }
 
             if (A_need_pack && B_need_pack) {
-                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A_packed, B_packed, beta, C, N);
+                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A_packed, B_packed, beta, C, N, epilogue);
             }
             else if (A_need_pack && !B_need_pack) {
-                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A_packed, B, beta, C, N);
+                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A_packed, B, beta, C, N, epilogue);
             }
             else if (!A_need_pack && B_need_pack) {
-                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A, B_packed, beta, C, N);
+                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A, B_packed, beta, C, N, epilogue);
             }
             else {
-                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A, B, beta, C, N);
+                kernel_8x8<T_IN, T_OUT>(M, K, N, alpha, A, B, beta, C, N, epilogue);
             }       
         }
 
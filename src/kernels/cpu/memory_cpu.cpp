@@ -7,25 +7,186 @@
 #include "global/memory_device.h"
 
 #include "utils/assert.h"
+#include "utils/platform.h"
+#include "utils/ctxmgr_lite_support.h"
 
 #include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <algorithm>
+#include <vector>
+
+#if TS_PLATFORM_OS_LINUX
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace ts {
+    static const size_t CPU_ALIGNMENT = 64;
+    static const size_t CPU_PAGE_SIZE = 4096;
+    static const size_t CPU_HUGE_PAGE_SIZE = size_t(2) << 20;
+    // smaller memory is placed on NUMA node by first touch of pinned threads, same as mmap threshold of glibc
+    static const size_t CPU_MAPPED_SIZE = size_t(128) << 10;
+
+    static std::atomic<bool> cpu_huge_page_enabled(false);
+
+    /**
+     * Saved just before each allocated memory
+     */
+    struct CpuMemoryHeader {
+        void *base;
+        size_t length;  ///< length of mapped pages, 0 means base is from malloc
+    };
+
+    static char *align_up(char *ptr, size_t alignment) {
+        return reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(ptr) + alignment - 1) & ~(alignment - 1));
+    }
+
+    static void *cpu_aligned_malloc(size_t size) {
+        auto base = reinterpret_cast<char *>(std::malloc(size + CPU_ALIGNMENT + sizeof(CpuMemoryHeader)));
+        if (base == nullptr) return nullptr;
+        auto data = align_up(base + sizeof(CpuMemoryHeader), CPU_ALIGNMENT);
+        auto header = reinterpret_cast<CpuMemoryHeader *>(data) - 1;
+        header->base = base;
+        header->length = 0;
+        return data;
+    }
+
+    /**
+     * prefer NUMA node for pages in [addr, addr + length)
+     */
+    static void cpu_bind_numa_node(void *addr, size_t length, int node) {
+#if TS_PLATFORM_OS_LINUX && defined(__NR_mbind)
+        static const int MPOL_PREFERRED_MODE = 1;   // MPOL_PREFERRED, falling back to other nodes if node is full
+        static const size_t BITS = 8 * sizeof(unsigned long);
+        std::vector<unsigned long> mask(size_t(node) / BITS + 1, 0);
+        mask[size_t(node) / BITS] |= 1UL << (size_t(node) % BITS);
+        syscall(__NR_mbind, addr, length, MPOL_PREFERRED_MODE, mask.data(), mask.size() * BITS + 1, 0);
+#else
+        TS_UNUSED(addr);
+        TS_UNUSED(length);
+        TS_UNUSED(node);
+#endif
+    }
+
+    /**
+     * map own pages, so they can be advised or placed without touching other memory
+     * @param size expected size
+     * @param huge_page align pages to huge page, and advise kernel backing them with transparent huge pages
+     * @param node NUMA node pages placed on, negative means no placement
+     * @return nullptr if failed
+     */
+    static void *cpu_mapped_malloc(size_t size, bool huge_page, int node) {
+#if TS_PLATFORM_OS_LINUX
+        auto page = huge_page ? CPU_HUGE_PAGE_SIZE : CPU_PAGE_SIZE;
+        auto used = (size + CPU_ALIGNMENT + page - 1) & ~(page - 1);
+        auto length = huge_page ? used + page : used;
+        auto mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED) return nullptr;
+        auto head = reinterpret_cast<char *>(mapped);
+        auto base = align_up(head, page);
+        if (base > head) munmap(head, size_t(base - head));
+        auto tail = base + used;
+        if (tail < head + length) munmap(tail, size_t(head + length - tail));
+#ifdef MADV_HUGEPAGE
+        if (huge_page) madvise(base, used, MADV_HUGEPAGE);
+#endif
+        // placed before first touch
+        if (node >= 0) cpu_bind_numa_node(base, used, node);
+        auto data = base + CPU_ALIGNMENT;
+        auto header = reinterpret_cast<CpuMemoryHeader *>(data) - 1;
+        header->base = base;
+        header->length = used;
+        return data;
+#else
+        TS_UNUSED(size);
+        TS_UNUSED(huge_page);
+        TS_UNUSED(node);
+        return nullptr;
+#endif
+    }
+
+    static void *cpu_malloc(size_t size) {
+        void *mem = nullptr;
+        if (size >= CPU_MAPPED_SIZE) {
+            auto huge_page = bool(cpu_huge_page_enabled);
+            int node = -1;
+            auto placement = ctx::get<CpuMemoryPlacement>();
+            if (placement != nullptr) {
+                huge_page = huge_page || placement->huge_page;
+                node = placement->numa_node;
+            }
+            huge_page = huge_page && size >= CPU_HUGE_PAGE_SIZE;
+            if (huge_page || node >= 0) mem = cpu_mapped_malloc(size, huge_page, node);
+        }
+        if (mem == nullptr) mem = cpu_aligned_malloc(size);
+        return mem;
+    }
+
+    static void cpu_free(void *mem) {
+        if (mem == nullptr) return;
+        auto header = reinterpret_cast<CpuMemoryHeader *>(mem) - 1;
+#if TS_PLATFORM_OS_LINUX
+        if (header->length) {
+            munmap(header->base, header->length);
+            return;
+        }
+#endif
+        std::free(header->base);
+    }
+
+    /**
+     * resize memory, keeping it in place if possible
+     * @return nullptr if failed, mem is not freed
+     */
+    static void *cpu_realloc(void *mem, size_t new_size, size_t mem_size) {
+        auto header = reinterpret_cast<CpuMemoryHeader *>(mem) - 1;
+        if (header->length) {
+            // mapped pages have room up to the page end
+            if (new_size <= header->length - CPU_ALIGNMENT) return mem;
+            auto new_mem = cpu_malloc(new_size);
+            if (new_mem == nullptr) return nullptr;
+            std::memcpy(new_mem, mem, std::min(new_size, mem_size));
+            cpu_free(mem);
+            return new_mem;
+        }
+        auto base = reinterpret_cast<char *>(header->base);
+        auto offset = reinterpret_cast<char *>(mem) - base;
+        auto new_base = reinterpret_cast<char *>(std::realloc(base, new_size + CPU_ALIGNMENT + sizeof(CpuMemoryHeader)));
+        if (new_base == nullptr) return nullptr;
+        auto data = align_up(new_base + sizeof(CpuMemoryHeader), CPU_ALIGNMENT);
+        // realloc keeps content at the old offset, which may be not aligned in moved block
+        if (data - new_base != offset) std::memmove(data, new_base + offset, std::min(new_size, mem_size));
+        header = reinterpret_cast<CpuMemoryHeader *>(data) - 1;
+        header->base = new_base;
+        header->length = 0;
+        return data;
+    }
+
+    void cpu_set_huge_page(bool enable) {
+        cpu_huge_page_enabled = enable;
+    }
+
+    bool cpu_get_huge_page() {
+        return cpu_huge_page_enabled;
+    }
+
     void *cpu_allocator(int id, size_t new_size, void *mem, size_t mem_size) {
         if (new_size == 0 && mem == nullptr) return nullptr;
         void *new_mem = nullptr;
         if (new_size == 0) {
-            std::free(mem);
+            cpu_free(mem);
             return nullptr;
         } else if (mem != nullptr) {
             if (mem_size) {
-                new_mem = std::realloc(mem, new_size);
+                new_mem = cpu_realloc(mem, new_size, mem_size);
             } else {
-                std::free(mem);
-                new_mem = std::malloc(new_size);
+                cpu_free(mem);
+                new_mem = cpu_malloc(new_size);
             }
         } else {
-            new_mem = std::malloc(new_size);
+            new_mem = cpu_malloc(new_size);
         }
         if (new_mem == nullptr) throw OutOfMemoryException(MemoryDevice(CPU, id), new_size);
         return new_mem;
@@ -39,6 +200,8 @@ namespace ts {
     }
 }
 
+TS_LITE_CONTEXT(ts::CpuMemoryPlacement)
+
 TS_STATIC_ACTION(ts::HardAllocator::Register, ts::CPU, ts::cpu_allocator)
 
 TS_STATIC_ACTION(ts::HardConverter::Register, ts::CPU, ts::CPU, ts::cpu_converter)
@@ -5,6 +5,7 @@
 #include "backend/base/base_activation.h"
 #include "runtime/stack.h"
 #include "global/operator_factory.h"
+#include "backend/name.h"
 
 #include "kernels/cpu/operator_on_cpu.h"
 #include "kernels/common/math.h"
@@ -65,4 +66,4 @@ namespace ts {
 
 using namespace ts;
 using namespace cpu;
-TS_REGISTER_OPERATOR(Tanh, CPU, "tanh")
\ No newline at end of file
+TS_REGISTER_OPERATOR(Tanh, CPU, name::layer::tanh())
\ No newline at end of file
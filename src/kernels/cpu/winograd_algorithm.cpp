@@ -270,12 +270,14 @@ namespace ts{
          * ]
          */
         template <typename T>
-        void Conv2dWinogradAlgorithm<T>::winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out){
+        void Conv2dWinogradAlgorithm<T>::winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                                      const Epilogue<T> *epilogue){
 
         }
 
         template <>
-        void Conv2dWinogradAlgorithm<float>::winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out){
+        void Conv2dWinogradAlgorithm<float>::winograd_f23_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                                      const Epilogue<float> *epilogue){
             Shape out_shape = out.sizes();
             Shape out_tm_shape = out_tm.sizes();
             int num = out_tm_shape[0];
@@ -339,6 +341,9 @@ namespace ts{
                             ++tile_offset;
                         }
                     }
+
+                    // plane of channel is still in cache
+                    if (epilogue) epilogue->apply(c, out_cur, out_channel_offset);
                 }
             }
         }
@@ -349,7 +354,8 @@ namespace ts{
                                              float padding_value,
                                              const Tensor &kernel,
                                              Tensor &out,
-                                             bool kernel_transformed){
+                                             bool kernel_transformed,
+                                             const Epilogue<T> *epilogue){
 
         }
 
@@ -359,7 +365,8 @@ namespace ts{
                                                  float padding_value,
                                                  const Tensor &kernel,
                                                  Tensor &out,
-                                                 bool kernel_transformed){
+                                                 bool kernel_transformed,
+                                             const Epilogue<float> *epilogue){
 
             int tile_width = 2;
             int tile_height = 2;
@@ -448,7 +455,7 @@ namespace ts{
             }
 
             //transform output
-            winograd_f23_transform_output(transform_out, tile_block_num, out_padded);
+            winograd_f23_transform_output(transform_out, tile_block_num, out_padded, epilogue);
 
             //cut output
             if (out_padded_flag) {
@@ -729,13 +736,15 @@ namespace ts{
          * ]
          */
         template <typename T>
-        void Conv2dWinogradAlgorithm<T>::winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out){
+        void Conv2dWinogradAlgorithm<T>::winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                                      const Epilogue<T> *epilogue){
 
         }
 
         //TODO:maybe simd optimize
         template <>
-        void Conv2dWinogradAlgorithm<float>::winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out){
+        void Conv2dWinogradAlgorithm<float>::winograd_f63_transform_output(const Tensor& out_tm, int tile_count, Tensor& out,
+                                                                      const Epilogue<float> *epilogue){
             Shape out_shape = out.sizes();
             Shape out_tm_shape = out_tm.sizes();
             int num = out_tm_shape[0];
@@ -828,6 +837,9 @@ namespace ts{
                             ++tile_offset;
                         }
                     }
+
+                    // plane of channel is still in cache
+                    if (epilogue) epilogue->apply(c, out_cur, out_channel_offset);
                 }
             }
         }
@@ -838,7 +850,8 @@ namespace ts{
                                              float padding_value,
                                              const Tensor &kernel,
                                              Tensor &out,
-                                             bool kernel_transformed){
+                                             bool kernel_transformed,
+                                             const Epilogue<T> *epilogue){
 
         }
 
@@ -848,7 +861,8 @@ namespace ts{
                                              float padding_value,
                                              const Tensor &kernel,
                                              Tensor &out,
-                                             bool kernel_transformed){
+                                             bool kernel_transformed,
+                                             const Epilogue<float> *epilogue){
             int tile_width = 6;
             int tile_height = 6;
 
@@ -936,7 +950,7 @@ namespace ts{
             }
 
             //transform output
-            winograd_f63_transform_output(transform_out, tile_block_num, out_padded);
+            winograd_f63_transform_output(transform_out, tile_block_num, out_padded, epilogue);
 
             //cut output
             if (out_padded_flag) {
@@ -11,6 +11,7 @@
 #include "orz/vat.h"
 
 #include <list>
+#include <mutex>
 
 namespace ts {
     class VatMemoryController::Implement {
@@ -34,25 +35,24 @@ namespace ts {
         m_impl->m_device = device;
         m_impl->m_vat = std::make_shared<Vat>(pot_allocator);
         auto &vat = m_impl->m_vat;
-        m_impl->m_managed_allocator = [vat](int, size_t new_size, void *mem, size_t mem_size) -> void * {
-            void *new_mem = nullptr;
+        // each HardMemory keeps its own copy of allocator, block records where its memory comes from
+        Vat::Block *block = nullptr;
+        m_impl->m_managed_allocator = [vat, block](int, size_t new_size, void *mem, size_t mem_size) mutable -> void * {
             if (new_size == 0) {
                 // TS_LOG_DEBUG << "free(" << mem << ")";
-                vat->free(mem);
+                vat->free(block);
+                block = nullptr;
                 return nullptr;
             } else if (mem != nullptr) {
                 if (mem_size > 0) {
                     TS_LOG_ERROR << "Reach the un-given code" << eject;
-                } else {
-                    vat->free(mem);
-                    new_mem = vat->malloc(new_size);
                 }
-                // TS_LOG_DEBUG << "realloc(" << mem << ") -> " << new_mem;
-            } else {
-                new_mem = vat->malloc(new_size);
-                // TS_LOG_DEBUG << "malloc() -> " << new_mem;
+                vat->free(block);
+                block = nullptr;
             }
-            return new_mem;
+            block = vat->malloc(new_size);
+            // TS_LOG_DEBUG << "malloc() -> " << block->data();
+            return block->data();
         };
     }
 
@@ -68,6 +68,72 @@ namespace ts {
         return m_impl->m_vat->summary();
     }
 
+    MemoryStatistics VatMemoryController::statistics() const {
+        return m_impl->m_vat->statistics();
+    }
+
+    class LockedVatMemoryController::Implement {
+    public:
+        using self = Implement;
+        MemoryDevice m_device;
+        HardAllocator::function m_managed_allocator;
+        std::shared_ptr<Vat> m_vat;
+        std::shared_ptr<std::mutex> m_mutex;
+    };
+
+    LockedVatMemoryController::LockedVatMemoryController(const MemoryDevice &device) {
+        TS_AUTO_CHECK(m_impl.get() != nullptr);
+        auto hard_allocator = HardAllocator::Query(device.type());
+        TS_CHECK(hard_allocator != nullptr) << "Can not found memory controller for " << device.type();
+        using namespace std::placeholders;
+        auto hard_free = std::bind(hard_allocator, device.id(), 0, _1, 0);
+        auto pot_allocator = [hard_allocator, device, hard_free](size_t size) -> std::shared_ptr<void> {
+            return std::shared_ptr<void>(hard_allocator(device.id(), size, nullptr, 0), hard_free);
+        };
+
+        m_impl->m_device = device;
+        m_impl->m_vat = std::make_shared<Vat>(pot_allocator);
+        m_impl->m_mutex = std::make_shared<std::mutex>();
+        auto &vat = m_impl->m_vat;
+        auto &mutex = m_impl->m_mutex;
+        Vat::Block *block = nullptr;
+        m_impl->m_managed_allocator = [vat, mutex, block](int, size_t new_size, void *mem, size_t mem_size) mutable -> void * {
+            std::unique_lock<std::mutex> _lock(*mutex);
+            if (new_size == 0) {
+                vat->free(block);
+                block = nullptr;
+                return nullptr;
+            } else if (mem != nullptr) {
+                if (mem_size > 0) {
+                    TS_LOG_ERROR << "Reach the un-given code" << eject;
+                }
+                vat->free(block);
+                block = nullptr;
+            }
+            block = vat->malloc(new_size);
+            return block->data();
+        };
+    }
+
+    LockedVatMemoryController::~LockedVatMemoryController() {
+        std::unique_lock<std::mutex> _lock(*m_impl->m_mutex);
+        m_impl->m_vat->deprecated();
+    }
+
+    Memory LockedVatMemoryController::alloc(size_t size) {
+        return Memory(std::make_shared<HardMemory>(m_impl->m_device, m_impl->m_managed_allocator, size));
+    }
+
+    uint64_t LockedVatMemoryController::summary() const {
+        std::unique_lock<std::mutex> _lock(*m_impl->m_mutex);
+        return m_impl->m_vat->summary();
+    }
+
+    MemoryStatistics LockedVatMemoryController::statistics() const {
+        std::unique_lock<std::mutex> _lock(*m_impl->m_mutex);
+        return m_impl->m_vat->statistics();
+    }
+
     class StackMemoryBlock {
     public:
         using self = StackMemoryBlock;
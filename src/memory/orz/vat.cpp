@@ -9,95 +9,234 @@
 
 namespace ts {
 
+    static const int BIN_STEPS_SHIFT = 2;   // 4 steps each power of two
+    static const int BIN_MIN_SHIFT = 6;     // 64 bytes for the smallest bin
+    static const int BITMAP_WORDS = (Vat::BINS + 63) / 64;
+
+    /**
+     * @param x not 0
+     */
+    static int highest_bit(uint64_t x) {
+#if defined(__GNUC__)
+        return 63 - __builtin_clzll(x);
+#else
+        int i = 0;
+        while (x >>= 1) ++i;
+        return i;
+#endif
+    }
+
+    /**
+     * @param x not 0
+     */
+    static int lowest_bit(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(x);
+#else
+        int i = 0;
+        while (!(x & 1)) {
+            x >>= 1;
+            ++i;
+        }
+        return i;
+#endif
+    }
+
+    /**
+     * @param size expected size
+     * @param [out] capacity capacity of bin
+     * @return bin index
+     */
+    static int size_bin(size_t size, size_t &capacity) {
+        if (size <= (size_t(1) << BIN_MIN_SHIFT)) {
+            capacity = size_t(1) << BIN_MIN_SHIFT;
+            return 0;
+        }
+        // 2^p < size <= 2^(p+1)
+        auto p = highest_bit(uint64_t(size - 1));
+        auto step = size_t(1) << (p - BIN_STEPS_SHIFT);
+        capacity = (size + step - 1) & ~(step - 1);
+        auto sub = int((capacity >> (p - BIN_STEPS_SHIFT)) - (size_t(1) << BIN_STEPS_SHIFT));
+        return 1 + ((p - BIN_MIN_SHIFT) << BIN_STEPS_SHIFT) + (sub - 1);
+    }
+
+    size_t Vat::Capacity(size_t size) {
+        size_t capacity;
+        size_bin(size, capacity);
+        return capacity;
+    }
+
     Vat::Vat()
         : self(nullptr) {
     }
 
     Vat::Vat(const Pot::allocator &ator)
-        : m_allocator(ator) {
+        : m_allocator(ator), m_bins(BINS, nullptr), m_bitmap(BITMAP_WORDS, 0) {
         // TS_LOG_DEBUG << "new Vat() -> " << this;
     }
 
     Vat::~Vat() {
         // TS_LOG_DEBUG << "delete Vat(" << this << ")";
+        this->clean();
+        while (m_used) {
+            auto block = m_used;
+            unlink(block);
+            delete block;
+        }
     }
 
-    static int binary_find(const std::vector<Pot> &heap, size_t size, int left, int right) {
+    int Vat::upper_bin(int bin) const {
+        if (bin >= BINS) return -1;
+        auto word = bin >> 6;
+        auto bits = m_bitmap[word] & (~uint64_t(0) << (bin & 63));
         while (true) {
-            if (right - left <= 0) return left;
-            int middle = (left + right) / 2;
-            if (heap[middle].capacity() < size) {
-                left = middle + 1;
-                continue;
-            }
-            if (middle > 0 && heap[middle - 1].capacity() >= size) {
-                right = middle - 1;
-                continue;
-            }
-            return middle;
+            if (bits) return (word << 6) + lowest_bit(bits);
+            if (++word >= BITMAP_WORDS) return -1;
+            bits = m_bitmap[word];
         }
     }
 
-    // find the position of Pot, which can contain the size, or return 0
-    // the return value
-    static int binary_find(const std::vector<Pot> &heap, size_t size) {
-        return binary_find(heap, size, 0, int(heap.size()) - 1);
+    int Vat::lower_bin(int bin) const {
+        if (bin <= 0) return -1;
+        --bin;
+        auto word = bin >> 6;
+        auto shift = bin & 63;
+        auto bits = m_bitmap[word] & (shift == 63 ? ~uint64_t(0) : ((uint64_t(1) << (shift + 1)) - 1));
+        while (true) {
+            if (bits) return (word << 6) + highest_bit(bits);
+            if (--word < 0) return -1;
+            bits = m_bitmap[word];
+        }
     }
 
-    void *Vat::malloc(size_t _size) {
-        if (_size == 0) return nullptr;
-        // find first small piece
-        Pot pot(m_allocator);
-        if (!m_heap.empty())
-        {
-            auto i = binary_find(m_heap, _size);
-            pot = m_heap[i];
-            m_heap.erase(m_heap.begin() + i);
+    void Vat::push(Block *block) {
+        auto bin = block->m_bin;
+        auto &head = m_bins[bin];
+        block->m_prev = nullptr;
+        block->m_next = head;
+        if (head) head->m_prev = block;
+        head = block;
+        m_bitmap[bin >> 6] |= uint64_t(1) << (bin & 63);
+        m_statistics.free_capacity += block->capacity();
+        ++m_statistics.free_blocks;
+    }
+
+    void Vat::pop(Block *block) {
+        auto bin = block->m_bin;
+        if (block->m_prev) {
+            block->m_prev->m_next = block->m_next;
+        } else {
+            m_bins[bin] = block->m_next;
+            if (!m_bins[bin]) m_bitmap[bin >> 6] &= ~(uint64_t(1) << (bin & 63));
         }
-        void *ptr = pot.malloc(_size);
-        m_dict.insert(std::pair<void *, Pot>(ptr, pot));
+        if (block->m_next) block->m_next->m_prev = block->m_prev;
+        block->m_prev = nullptr;
+        block->m_next = nullptr;
+        m_statistics.free_capacity -= block->capacity();
+        --m_statistics.free_blocks;
+    }
 
-        return ptr;
+    void Vat::link(Block *block) {
+        block->m_prev = nullptr;
+        block->m_next = m_used;
+        if (m_used) m_used->m_prev = block;
+        m_used = block;
+        m_statistics.used_size += block->m_size;
+        m_statistics.used_capacity += block->capacity();
+        ++m_statistics.used_blocks;
     }
 
-    void Vat::free(const void *ptr) {
-        if (ptr == nullptr) return;
-        auto key = const_cast<void *>(ptr);
-        auto it = m_dict.find(key);
-        if (it == m_dict.end()) {
-            throw Exception("Can not free this ptr");
+    void Vat::unlink(Block *block) {
+        if (block->m_prev) {
+            block->m_prev->m_next = block->m_next;
+        } else {
+            m_used = block->m_next;
         }
+        if (block->m_next) block->m_next->m_prev = block->m_prev;
+        block->m_prev = nullptr;
+        block->m_next = nullptr;
+        m_statistics.used_size -= block->m_size;
+        m_statistics.used_capacity -= block->capacity();
+        --m_statistics.used_blocks;
+    }
+
+    void Vat::destroy(Block *block) {
+        pop(block);
+        delete block;
+    }
 
-        if (!m_deprecated) {
-            auto &pot = it->second;
-            auto i = binary_find(m_heap, pot.capacity());
-            auto ind = m_heap.begin() + i;
-            m_heap.insert(ind, pot);
+    Vat::Block *Vat::malloc(size_t _size) {
+        if (_size == 0) return nullptr;
+        size_t capacity;
+        auto bin = size_bin(_size, capacity);
+
+        Block *block = nullptr;
+        auto found = upper_bin(bin);
+        if (found >= 0) {
+            // first fit, larger bin is used only if no smaller one
+            block = m_bins[found];
+            pop(block);
+        } else {
+            found = lower_bin(bin);
+            if (found >= 0) {
+                // grow the largest free block, keeping count of blocks
+                block = m_bins[found];
+                pop(block);
+                block->m_pot.dispose();
+            } else {
+                block = new Block(m_allocator);
+            }
+            try {
+                block->m_pot.malloc(capacity);
+            } catch (...) {
+                delete block;
+                throw;
+            }
+            block->m_bin = bin;
         }
 
-        m_dict.erase(it);
+        block->m_size = _size;
+        link(block);
+        return block;
+    }
+
+    void Vat::free(Block *block) {
+        if (block == nullptr || block->m_size == 0) return;
+        unlink(block);
+        block->m_size = 0;
+        if (m_deprecated) {
+            delete block;
+            return;
+        }
+        push(block);
     }
 
     void Vat::reset() {
-        for (auto &pair : m_dict) {
-            m_heap.push_back(pair.second);
+        while (m_used) {
+            auto block = m_used;
+            unlink(block);
+            block->m_size = 0;
+            push(block);
         }
-        m_dict.clear();
-        std::sort(m_heap.begin(), m_heap.end(), [](const Pot &p1, const Pot &p2){return p1.capacity() < p2.capacity(); });
     }
 
     void Vat::dispose() {
-        m_dict.clear();
-        m_heap.clear();
+        // living blocks are owned by users, released when freed
+        this->clean();
     }
 
     void Vat::swap(Vat &that)
     {
-        this->m_heap.swap(that.m_heap);
-        this->m_dict.swap(that.m_dict);
+        std::swap(this->m_allocator, that.m_allocator);
+        this->m_bins.swap(that.m_bins);
+        this->m_bitmap.swap(that.m_bitmap);
+        std::swap(this->m_used, that.m_used);
+        std::swap(this->m_statistics, that.m_statistics);
+        std::swap(this->m_deprecated, that.m_deprecated);
     }
 
     Vat::Vat(Vat &&that)
+        : m_bins(BINS, nullptr), m_bitmap(BITMAP_WORDS, 0)
     {
         this->swap(that);
     }
@@ -109,8 +248,9 @@ namespace ts {
     }
 
     void Vat::clean() {
-        this->m_heap.clear();
-        this->m_heap.shrink_to_fit();
+        for (auto bin = upper_bin(0); bin >= 0; bin = upper_bin(bin)) {
+            while (m_bins[bin]) destroy(m_bins[bin]);
+        }
     }
 
     void Vat::deprecated() {
@@ -119,13 +259,10 @@ namespace ts {
     }
 
     uint64_t Vat::summary() const {
-        uint64_t sum = 0;
-        for (auto &a : this->m_heap) {
-            sum += a.capacity();
-        }
-        for (auto &b : this->m_dict) {
-            sum  += b.second.capacity();
-        }
-        return sum;
+        return m_statistics.used_capacity + m_statistics.free_capacity;
+    }
+
+    Vat::Statistics Vat::statistics() const {
+        return m_statistics;
     }
 }
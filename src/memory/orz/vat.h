@@ -6,35 +6,66 @@
 #define ORZ_MEM_VAT_H
 
 #include "pot.h"
+#include "core/controller.h"
 #include <vector>
-#include <map>
-#include <unordered_map>
+#include <cstdint>
 
 namespace ts {
 
+    /**
+     * Reuse pots by size class.
+     * Sizes are rounded up to classes of 4 steps per power of two (at least 64 bytes),
+     *     free blocks are kept in one LIFO list per class, with bitmap of non-empty classes.
+     * malloc takes block of the first non-empty class fitting the size, or grows the largest free smaller one,
+     *     free puts block back to its class, both O(1) in count of blocks.
+     * Each allocation is described by a Block living on host, so device pointers are never looked up or touched.
+     */
     class Vat {
     public:
         using self = Vat;
 
+        class Block {
+        public:
+            void *data() const { return m_pot.data(); }
+
+            size_t size() const { return m_size; }
+
+            size_t capacity() const { return m_pot.capacity(); }
+
+        private:
+            friend class Vat;
+
+            explicit Block(const Pot::allocator &ator) : m_pot(ator) {}
+
+            Pot m_pot;
+            size_t m_size = 0;      ///< requested size, 0 means free
+            int m_bin = -1;
+            Block *m_prev = nullptr;    ///< link in free list of bin, or in used list
+            Block *m_next = nullptr;
+        };
+
+        /**
+         * Bytes held by vat
+         */
+        using Statistics = MemoryStatistics;
+
         Vat();
 
         Vat(const Pot::allocator &ator);
 
         ~Vat();
 
-        void *malloc(size_t _size);
-
-        template<typename T>
-        T *calloc(size_t _count) {
-            return reinterpret_cast<T *>(this->malloc(sizeof(T) * _count));
-        }
-
-        template<typename T>
-        std::shared_ptr<T> calloc_shared(size_t _count) {
-            return std::shared_ptr<T>(calloc<T>(_count), [this](T*ptr){this->free(ptr); });
-        }
+        /**
+         * @param _size expected size
+         * @return block with at least _size bytes, nullptr if _size is 0
+         */
+        Block *malloc(size_t _size);
 
-        void free(const void *ptr);
+        /**
+         * return block to vat, or release its memory if vat deprecated
+         * @param block returned by malloc, ignored if nullptr or already freed
+         */
+        void free(Block *block);
 
         /**
          * @brief doing like free all malloc ptrs
@@ -57,16 +88,49 @@ namespace ts {
         Vat &operator=(Vat &&that);
 
         uint64_t summary() const;
+
+        Statistics statistics() const;
+
+        /**
+         * @param size expected size
+         * @return capacity of size class containing size
+         */
+        static size_t Capacity(size_t size);
+
+        static const int BINS = 256;
+
     private:
         Vat(const Vat &that) = delete;
 
         Vat &operator=(const Vat &that) = delete;
 
+        void push(Block *block);
+
+        void pop(Block *block);
+
+        void link(Block *block);
+
+        void unlink(Block *block);
+
+        void destroy(Block *block);
+
+        /**
+         * @return first non-empty bin in [bin, BINS), or -1
+         */
+        int upper_bin(int bin) const;
+
+        /**
+         * @return last non-empty bin in [0, bin), or -1
+         */
+        int lower_bin(int bin) const;
+
         Pot::allocator m_allocator = nullptr;
 
-        // std::vector<RopedPot> m_list;
-        std::unordered_map<void *, Pot> m_dict;	///< save pair of pointer and index
-        std::vector<Pot> m_heap;	///< save all free memory, small fisrt sort
+        std::vector<Block *> m_bins;        ///< head of free list of each bin
+        std::vector<uint64_t> m_bitmap;     ///< bit set if bin not empty
+        Block *m_used = nullptr;            ///< list of living blocks
+
+        Statistics m_statistics;
 
         bool m_deprecated = false;
     };
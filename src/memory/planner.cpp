@@ -0,0 +1,313 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "memory/planner.h"
+
+#include "global/hard_allocator.h"
+#include "utils/assert.h"
+#include "orz/vat.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+namespace ts {
+    static inline size_t align_size(size_t size, size_t alignment) {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    static inline int64_t lifetime_end(const MemoryPlan::Lifetime &lifetime) {
+        return lifetime.free < 0 ? INT64_MAX : lifetime.free;
+    }
+
+    static inline bool lifetime_overlap(const MemoryPlan::Lifetime &a, const MemoryPlan::Lifetime &b) {
+        return a.alloc < lifetime_end(b) && b.alloc < lifetime_end(a);
+    }
+
+    static inline bool memory_overlap(const MemoryPlan::Block &a, const MemoryPlan::Block &b) {
+        return a.offset < b.offset + b.size && b.offset < a.offset + a.size;
+    }
+
+    MemoryPlan::shared MemoryPlan::Build(const std::vector<Lifetime> &lifetimes, size_t alignment) {
+        if (alignment == 0) alignment = 1;
+        auto plan = std::make_shared<MemoryPlan>();
+        auto count = lifetimes.size();
+        plan->m_blocks.resize(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            plan->m_blocks[i].size = align_size(lifetimes[i].size, alignment);
+            plan->m_total_size += plan->m_blocks[i].size;
+        }
+
+        // place bigger blocks first
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return plan->m_blocks[lhs].size > plan->m_blocks[rhs].size;
+        });
+
+        std::vector<size_t> placed;
+        std::vector<size_t> living;
+        for (auto i : order) {
+            auto &block = plan->m_blocks[i];
+            // placed blocks alive at the same time, sorted by offset
+            living.clear();
+            for (auto j : placed) {
+                if (lifetime_overlap(lifetimes[i], lifetimes[j])) living.push_back(j);
+            }
+            std::sort(living.begin(), living.end(), [&](size_t lhs, size_t rhs) {
+                return plan->m_blocks[lhs].offset < plan->m_blocks[rhs].offset;
+            });
+            // find the smallest gap can hold this block
+            size_t offset = 0;
+            size_t best_offset = 0;
+            size_t best_gap = SIZE_MAX;
+            for (auto j : living) {
+                auto &other = plan->m_blocks[j];
+                if (other.offset >= offset + block.size) {
+                    auto gap = other.offset - offset;
+                    if (gap < best_gap) {
+                        best_gap = gap;
+                        best_offset = offset;
+                    }
+                }
+                offset = std::max(offset, other.offset + other.size);
+            }
+            block.offset = best_gap == SIZE_MAX ? offset : best_offset;
+            plan->m_arena_size = std::max(plan->m_arena_size, block.offset + block.size);
+            placed.push_back(i);
+        }
+
+        // blocks sharing memory, the later one must wait the earlier one freed
+        for (size_t i = 0; i < count; ++i) {
+            auto &block = plan->m_blocks[i];
+            for (size_t j = 0; j < i; ++j) {
+                if (memory_overlap(block, plan->m_blocks[j])) block.reused.push_back(int(j));
+            }
+        }
+
+        return plan;
+    }
+
+    /**
+     * arena used by one replay
+     */
+    class PlannedArena {
+    public:
+        using self = PlannedArena;
+        using shared = std::shared_ptr<self>;
+
+        std::shared_ptr<void> data;
+        size_t size = 0;
+        std::vector<char> alive;
+        size_t living = 0;
+    };
+
+    /**
+     * lifetimes recorded in one run
+     */
+    class PlannedRecord {
+    public:
+        using self = PlannedRecord;
+        using shared = std::shared_ptr<self>;
+
+        bool recording = true;
+        int64_t tick = 0;
+        std::vector<MemoryPlan::Lifetime> lifetimes;
+    };
+
+    class PlannedMemoryController::Implement {
+    public:
+        using self = Implement;
+
+        enum Mode {
+            IDLE,
+            RECORD,
+            REPLAY,
+        };
+
+        MemoryDevice m_device;
+        Pot::allocator m_pot_allocator;
+        std::shared_ptr<Vat> m_vat;
+        HardAllocator::function m_managed_allocator;
+
+        Mode m_mode = IDLE;
+        PlannedRecord::shared m_record;
+        MemoryPlan::shared m_plan;
+        PlannedArena::shared m_arena;
+        size_t m_replay_index = 0;
+        size_t m_missed = 0;
+
+        Memory alloc_record(size_t size) {
+            auto record = m_record;
+            auto index = record->lifetimes.size();
+            MemoryPlan::Lifetime lifetime;
+            lifetime.size = size;
+            lifetime.alloc = record->tick++;
+            record->lifetimes.push_back(lifetime);
+            auto vat = m_vat;
+            Vat::Block *block = nullptr;
+            auto allocator = [vat, record, index, block](int, size_t new_size, void *mem, size_t mem_size) mutable -> void * {
+                if (new_size == 0) {
+                    vat->free(block);
+                    block = nullptr;
+                    if (record->recording) record->lifetimes[index].free = record->tick++;
+                    return nullptr;
+                } else if (mem != nullptr) {
+                    TS_LOG_ERROR << "Reach the un-given code" << eject;
+                }
+                block = vat->malloc(new_size);
+                return block->data();
+            };
+            return Memory(std::make_shared<HardMemory>(m_device, allocator, size));
+        }
+
+        Memory alloc_replay(size_t size) {
+            auto index = m_replay_index++;
+            if (index >= m_plan->count()) return miss(size);
+            auto &block = m_plan->block(index);
+            if (size > block.size) return miss(size);
+            auto &alive = m_arena->alive;
+            for (auto reused : block.reused) {
+                if (alive[reused]) return miss(size);
+            }
+            alive[index] = 1;
+            ++m_arena->living;
+            auto arena = m_arena;
+            void *data = reinterpret_cast<char *>(arena->data.get()) + block.offset;
+            auto capacity = block.size;
+            auto allocator = [arena, index, data, capacity](int, size_t new_size, void *mem, size_t mem_size) -> void * {
+                if (new_size == 0) {
+                    if (arena->alive[index]) {
+                        arena->alive[index] = 0;
+                        --arena->living;
+                    }
+                    return nullptr;
+                } else if (new_size > capacity) {
+                    TS_LOG_ERROR << "Reach the un-given code" << eject;
+                }
+                return data;
+            };
+            return Memory(std::make_shared<HardMemory>(m_device, allocator, size));
+        }
+
+        Memory miss(size_t size) {
+            ++m_missed;
+            return Memory(std::make_shared<HardMemory>(m_device, m_managed_allocator, size));
+        }
+
+        void prepare_arena() {
+            auto arena_size = m_plan->arena_size();
+            if (m_arena == nullptr || m_arena->living > 0 || m_arena->size < arena_size) {
+                m_arena = std::make_shared<PlannedArena>();
+                m_arena->data = m_pot_allocator(arena_size);
+                m_arena->size = arena_size;
+            }
+            m_arena->alive.assign(m_plan->count(), 0);
+        }
+    };
+
+    PlannedMemoryController::PlannedMemoryController(const MemoryDevice &device) {
+        TS_AUTO_CHECK(m_impl.get() != nullptr);
+        auto hard_allocator = HardAllocator::Query(device.type());
+        TS_CHECK(hard_allocator != nullptr) << "Can not found memory controller for " << device.type();
+        using namespace std::placeholders;
+        auto hard_free = std::bind(hard_allocator, device.id(), 0, _1, 0);
+        auto pot_allocator = [hard_allocator, device, hard_free](size_t size) -> std::shared_ptr<void> {
+            return std::shared_ptr<void>(hard_allocator(device.id(), size, nullptr, 0), hard_free);
+        };
+
+        m_impl->m_device = device;
+        m_impl->m_pot_allocator = pot_allocator;
+        m_impl->m_vat = std::make_shared<Vat>(pot_allocator);
+        auto &vat = m_impl->m_vat;
+        Vat::Block *block = nullptr;
+        m_impl->m_managed_allocator = [vat, block](int, size_t new_size, void *mem, size_t mem_size) mutable -> void * {
+            if (new_size == 0) {
+                vat->free(block);
+                block = nullptr;
+                return nullptr;
+            } else if (mem != nullptr) {
+                if (mem_size > 0) {
+                    TS_LOG_ERROR << "Reach the un-given code" << eject;
+                }
+                vat->free(block);
+                block = nullptr;
+            }
+            block = vat->malloc(new_size);
+            return block->data();
+        };
+    }
+
+    PlannedMemoryController::~PlannedMemoryController() {
+        m_impl->m_vat->deprecated();
+    }
+
+    Memory PlannedMemoryController::alloc(size_t size) {
+        switch (m_impl->m_mode) {
+            default:
+            case Implement::IDLE:
+                return Memory(std::make_shared<HardMemory>(m_impl->m_device, m_impl->m_managed_allocator, size));
+            case Implement::RECORD:
+                return m_impl->alloc_record(size);
+            case Implement::REPLAY:
+                return m_impl->alloc_replay(size);
+        }
+    }
+
+    uint64_t PlannedMemoryController::summary() const {
+        uint64_t sum = m_impl->m_vat->summary();
+        if (m_impl->m_arena) sum += m_impl->m_arena->size;
+        return sum;
+    }
+
+    MemoryStatistics PlannedMemoryController::statistics() const {
+        auto statistics = m_impl->m_vat->statistics();
+        auto &arena = m_impl->m_arena;
+        if (arena == nullptr) return statistics;
+        if (arena->living > 0) {
+            // offsets are packed by plan, so the whole arena is taken as requested
+            statistics.used_size += arena->size;
+            statistics.used_capacity += arena->size;
+            ++statistics.used_blocks;
+        } else {
+            statistics.free_capacity += arena->size;
+            ++statistics.free_blocks;
+        }
+        return statistics;
+    }
+
+    void PlannedMemoryController::record() {
+        finish();
+        m_impl->m_record = std::make_shared<PlannedRecord>();
+        m_impl->m_mode = Implement::RECORD;
+    }
+
+    void PlannedMemoryController::replay(MemoryPlan::shared plan) {
+        finish();
+        if (plan == nullptr) return;
+        m_impl->m_plan = std::move(plan);
+        m_impl->m_replay_index = 0;
+        m_impl->m_missed = 0;
+        m_impl->prepare_arena();
+        m_impl->m_mode = Implement::REPLAY;
+    }
+
+    MemoryPlan::shared PlannedMemoryController::finish() {
+        MemoryPlan::shared plan;
+        if (m_impl->m_mode == Implement::RECORD) {
+            auto &record = m_impl->m_record;
+            record->recording = false;
+            plan = MemoryPlan::Build(record->lifetimes);
+            record.reset();
+        }
+        m_impl->m_plan.reset();
+        m_impl->m_mode = Implement::IDLE;
+        return plan;
+    }
+
+    size_t PlannedMemoryController::missed() const {
+        return m_impl->m_missed;
+    }
+}
@@ -0,0 +1,160 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "module/io/mstream.h"
+
+#include "core/memory.h"
+#include "utils/platform.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#if TS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ts {
+    /**
+     * alive mappings, map begin to end
+     */
+    static std::mutex &mapped_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::map<const char *, const char *> &mapped_ranges() {
+        static std::map<const char *, const char *> ranges;
+        return ranges;
+    }
+
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string &path) {
+#if TS_PLATFORM_OS_WINDOWS
+            auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return;
+            }
+            auto mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (mapping == nullptr) return;
+            auto data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(mapping);
+            if (data == nullptr) return;
+            m_size = size_t(size.QuadPart);
+#else
+            auto fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) return;
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size == 0) {
+                ::close(fd);
+                return;
+            }
+            // copy-on-write, writing tensor never changes file
+            auto data = mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (data == MAP_FAILED) return;
+            m_size = size_t(st.st_size);
+#endif
+            m_data = reinterpret_cast<char *>(data);
+            std::unique_lock<std::mutex> _lock(mapped_mutex());
+            mapped_ranges()[m_data] = m_data + m_size;
+        }
+
+        ~MappedFile() {
+            if (m_data == nullptr) return;
+            {
+                std::unique_lock<std::mutex> _lock(mapped_mutex());
+                mapped_ranges().erase(m_data);
+            }
+#if TS_PLATFORM_OS_WINDOWS
+            UnmapViewOfFile(m_data);
+#else
+            munmap(m_data, m_size);
+#endif
+        }
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        char *data() const { return m_data; }
+
+        size_t size() const { return m_size; }
+
+    private:
+        char *m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    MappedStreamReader::MappedStreamReader() = default;
+
+    MappedStreamReader::MappedStreamReader(const std::string &path) {
+        open(path);
+    }
+
+    void MappedStreamReader::open(const std::string &path) {
+        m_file = std::make_shared<MappedFile>(path);
+        m_position = 0;
+        if (m_file->data() == nullptr) m_file.reset();
+    }
+
+    bool MappedStreamReader::is_open() const {
+        return m_file != nullptr;
+    }
+
+    void MappedStreamReader::close() {
+        m_file.reset();
+        m_position = 0;
+    }
+
+    size_t MappedStreamReader::size() const {
+        return m_file ? m_file->size() : 0;
+    }
+
+    size_t MappedStreamReader::read(void *buffer, size_t size) {
+        size = std::min(size, this->size() - m_position);
+        if (size == 0) return 0;
+        std::memcpy(buffer, m_file->data() + m_position, size);
+        m_position += size;
+        return size;
+    }
+
+    size_t MappedStreamReader::skip(size_t size) {
+        size = std::min(size, this->size() - m_position);
+        m_position += size;
+        return size;
+    }
+
+    bool MappedStreamReader::view(size_t size, Memory &memory) {
+        if (!m_file) return false;
+        if (size > this->size() - m_position) return false;
+        auto file = m_file;
+        memory = Memory(MemoryDevice(CPU), file->data() + m_position, size);
+        memory.destructor([file]() {});
+        m_position += size;
+        return true;
+    }
+
+    bool MappedStreamReader::Mapped(const void *data) {
+        auto ptr = reinterpret_cast<const char *>(data);
+        std::unique_lock<std::mutex> _lock(mapped_mutex());
+        auto &ranges = mapped_ranges();
+        auto it = ranges.upper_bound(ptr);
+        if (it == ranges.begin()) return false;
+        --it;
+        return ptr < it->second;
+    }
+}
@@ -6,7 +6,61 @@
 #include <module/io/stream.h>
 
 #include "module/io/stream.h"
+#include "module/io/mstream.h"
 #include "module/serialization.h"
+#include "core/memory.h"
+
+#include <vector>
 
 namespace ts {
+    static size_t padding_size(size_t position, size_t alignment) {
+        if (alignment <= 1) return 0;
+        return (alignment - position % alignment) % alignment;
+    }
+
+    AlignedStreamReader::AlignedStreamReader(StreamReader &stream, size_t alignment, size_t position)
+            : m_stream(stream), m_alignment(alignment), m_position(position) {}
+
+    size_t AlignedStreamReader::read(void *buffer, size_t size) {
+        auto read_size = m_stream.read(buffer, size);
+        m_position += read_size;
+        return read_size;
+    }
+
+    size_t AlignedStreamReader::align() {
+        auto size = padding_size(m_position, m_alignment);
+        if (size == 0) return 0;
+        auto mapped = dynamic_cast<MappedStreamReader *>(&m_stream);
+        if (mapped) {
+            size = mapped->skip(size);
+            m_position += size;
+            return size;
+        }
+        std::vector<char> padding(size);
+        return read(padding.data(), size);
+    }
+
+    bool AlignedStreamReader::view(size_t size, Memory &memory) {
+        auto mapped = dynamic_cast<MappedStreamReader *>(&m_stream);
+        if (!mapped) return false;
+        if (!mapped->view(size, memory)) return false;
+        m_position += size;
+        return true;
+    }
+
+    AlignedStreamWriter::AlignedStreamWriter(StreamWriter &stream, size_t alignment, size_t position)
+            : m_stream(stream), m_alignment(alignment), m_position(position) {}
+
+    size_t AlignedStreamWriter::write(const void *buffer, size_t size) {
+        auto writen_size = m_stream.write(buffer, size);
+        m_position += writen_size;
+        return writen_size;
+    }
+
+    size_t AlignedStreamWriter::align() {
+        auto size = padding_size(m_position, m_alignment);
+        if (size == 0) return 0;
+        std::vector<char> padding(size, 0);
+        return write(padding.data(), size);
+    }
 }
@@ -8,6 +8,7 @@
 #include <utility>
 #include <climits>
 #include <algorithm>
+#include <cstring>
 
 #include <module/module.h>
 
@@ -16,6 +17,7 @@
 #include "utils/box.h"
 #include "core/tensor_builder.h"
 #include "module/io/fstream.h"
+#include "module/io/mstream.h"
 #include "module/menu.h"
 #include "module/header.h"
 
@@ -233,8 +235,12 @@ namespace ts {
         return std::move(computation_schedule);
     }
 
+    static bool is_binary(Module::SerializationFormat format) {
+        return format == Module::BINARY || format == Module::ALIGNED_BINARY;
+    }
+
     void Module::Save(StreamWriter &stream, Module::shared module, Module::SerializationFormat format) {
-        TS_AUTO_CHECK(format == BINARY);
+        TS_AUTO_CHECK(is_binary(format));
         auto valued_nodes = list_reference_nodes(module->outputs());
         std::vector<Node> nodes;
         std::unordered_map<Node, size_t> map_node_index;
@@ -254,24 +260,33 @@ namespace ts {
         // 0. save header
         Header header;
         header.code = TS_MODULE_CODE_V1;
-        header.serialize(stream);
+        uint32_t alignment = 1;
+        if (format == ALIGNED_BINARY) {
+            header.code = TS_MODULE_CODE_V1_ALIGNED;
+            alignment = TS_MODULE_ALIGNMENT;
+            std::memcpy(header.data.data(), &alignment, sizeof(alignment));
+        }
+        auto header_size = header.serialize(stream);
+
+        // padding is only written if alignment > 1
+        AlignedStreamWriter aligned_stream(stream, alignment, header_size);
 
         // 1. save inputs
-        binio::write<uint32_t>(stream, uint32_t(module->inputs().size()));
+        binio::write<uint32_t>(aligned_stream, uint32_t(module->inputs().size()));
         for (auto &node : module->inputs()) {
-            binio::write<uint32_t>(stream, uint32_t(map_node_index[node]));
+            binio::write<uint32_t>(aligned_stream, uint32_t(map_node_index[node]));
         }
         // 2. save outputs
-        binio::write<uint32_t>(stream, uint32_t(module->outputs().size()));
+        binio::write<uint32_t>(aligned_stream, uint32_t(module->outputs().size()));
         for (auto &node : module->outputs()) {
-            binio::write<uint32_t>(stream, uint32_t(map_node_index[node]));
+            binio::write<uint32_t>(aligned_stream, uint32_t(map_node_index[node]));
         }
         // 3. save graphs
-        serialize_nodes(stream, nodes);
+        serialize_nodes(aligned_stream, nodes);
     }
 
     void Module::Save(const std::string &filename, Module::shared module, Module::SerializationFormat format) {
-        TS_AUTO_CHECK(format == BINARY);
+        TS_AUTO_CHECK(is_binary(format));
         FileStreamWriter stream(filename);
 
         TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
@@ -289,17 +304,8 @@ namespace ts {
         return read_size;
     }
 
-    Module::shared Module::Load(StreamReader &stream, Module::SerializationFormat format) {
-        TS_AUTO_CHECK(format == BINARY);
-        //FileStreamReader stream(filename);
-        //TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
+    static Module::shared load_module(StreamReader &stream) {
         size_t read_size = 0;
-
-        // 0. read header
-        Header header;
-        read_size += header.externalize(stream);
-        TS_AUTO_CHECK(header.code == TS_MODULE_CODE_V1);
-
         // 1. read inputs
         // read node index
         std::vector<uint32_t> input_index;
@@ -322,13 +328,40 @@ namespace ts {
         return module;
     }
 
+    Module::shared Module::Load(StreamReader &stream, Module::SerializationFormat format) {
+        TS_AUTO_CHECK(is_binary(format));
+        //FileStreamReader stream(filename);
+        //TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
+        size_t read_size = 0;
+
+        // 0. read header
+        Header header;
+        read_size += header.externalize(stream);
+        if (header.code == TS_MODULE_CODE_V1) {
+            return load_module(stream);
+        }
+        TS_AUTO_CHECK(header.code == TS_MODULE_CODE_V1_ALIGNED);
+        uint32_t alignment = 1;
+        std::memcpy(&alignment, header.data.data(), sizeof(alignment));
+
+        AlignedStreamReader aligned_stream(stream, alignment, read_size);
+        return load_module(aligned_stream);
+    }
+
     Module::shared Module::Load(const std::string &filename, Module::SerializationFormat format) {
-        TS_AUTO_CHECK(format == BINARY);
+        TS_AUTO_CHECK(is_binary(format));
         FileStreamReader stream(filename);
         TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
         return Load(stream, format);
     }
 
+    Module::shared Module::LoadMapped(const std::string &filename, Module::SerializationFormat format) {
+        TS_AUTO_CHECK(is_binary(format));
+        MappedStreamReader stream(filename);
+        TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
+        return Load(stream, format);
+    }
+
     void Module::set_param(const std::string &node_name, const std::string &param, const Tensor &value) {
         for (auto &graph : m_graphs) {
             for (auto &node : graph.nodes()) {
@@ -0,0 +1,317 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/batching_workbench.h"
+
+#include "core/memory.h"
+#include "utils/log.h"
+
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+namespace ts {
+    /**
+     * one request waiting for batching
+     */
+    class BatchingRequest {
+    public:
+        using self = BatchingRequest;
+        using shared = std::shared_ptr<self>;
+
+        std::vector<Tensor> inputs;
+        int batch = 0;                  ///< 0 means can not be batched with others
+        std::chrono::steady_clock::time_point arrival;  ///< time of enqueue
+        std::promise<std::vector<Tensor>> outputs;
+    };
+
+    /**
+     * @return true if a and b can be concatenated along dim 0
+     */
+    static bool batchable(const BatchingRequest &a, const BatchingRequest &b) {
+        if (a.batch <= 0 || b.batch <= 0) return false;
+        if (a.inputs.size() != b.inputs.size()) return false;
+        for (size_t i = 0; i < a.inputs.size(); ++i) {
+            auto &x = a.inputs[i];
+            auto &y = b.inputs[i];
+            if (x.dtype() != y.dtype()) return false;
+            if (x.device() != y.device()) return false;
+            if (x.dims() != y.dims()) return false;
+            if (!std::equal(x.sizes().begin() + 1, x.sizes().end(), y.sizes().begin() + 1)) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @return batch of inputs, 0 if inputs can not be batched
+     */
+    static int batch_of(const std::vector<Tensor> &inputs) {
+        if (inputs.empty()) return 0;
+        int batch = -1;
+        for (auto &input : inputs) {
+            if (input.packed() || input.dims() < 1) return 0;
+            if (batch >= 0 && input.size(0) != batch) return 0;
+            batch = input.size(0);
+        }
+        return batch;
+    }
+
+    /**
+     * @return shape of each tensor except dim 0
+     */
+    static std::vector<std::vector<int32_t>> trailing_shapes(const std::vector<Tensor> &values) {
+        std::vector<std::vector<int32_t>> shapes;
+        for (auto &value : values) {
+            auto &sizes = value.sizes();
+            shapes.emplace_back(sizes.empty() ? sizes.end() : sizes.begin() + 1, sizes.end());
+        }
+        return shapes;
+    }
+
+    static Tensor concat(const std::vector<Tensor> &values) {
+        auto &first = values.front();
+        auto shape = first.sizes();
+        shape[0] = 0;
+        for (auto &value : values) shape[0] += value.size(0);
+
+        Tensor batched(first.device(), first.dtype(), shape);
+        auto dst = batched.data<char>();
+        for (auto &value : values) {
+            auto bytes = size_t(value.count()) * value.proto().type_bytes();
+            memcpy(dst, batched.device(), bytes, value.data(), value.device(), bytes);
+            dst += bytes;
+        }
+        return batched;
+    }
+
+    class BatchingWorkbench::Implement {
+    public:
+        using self = Implement;
+
+        Workbench::shared bench;
+        int max_batch_size = 1;
+        std::chrono::microseconds timeout;
+
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::deque<BatchingRequest::shared> requests;
+        bool running = true;
+
+        std::thread dispatcher;
+
+        /**
+         * if dim 0 of outputs follows batch of inputs, learned from requests run alone.
+         * 0 for unknown, 1 for yes, -1 for no. Requests are only batched after yes.
+         */
+        int batched_outputs = 0;
+        std::vector<std::vector<int32_t>> alone_input_shapes;   ///< trailing shapes of last request run alone
+        std::vector<std::vector<int32_t>> alone_output_shapes;
+
+        void dispatch() {
+            while (true) {
+                auto batch = collect();
+                if (batch.empty()) break;
+                launch(batch);
+            }
+        }
+
+        /**
+         * wait until batch full or timeout
+         * @return requests in batch, empty if stopped
+         */
+        std::vector<BatchingRequest::shared> collect() {
+            std::unique_lock<std::mutex> _lock(mutex);
+            while (running && requests.empty()) cond.wait(_lock);
+            if (requests.empty()) return {};
+
+            auto first = requests.front();
+            // first request waits no more than timeout since enqueued
+            auto deadline = first->arrival + timeout;
+            auto ready = [&]() {
+                if (!running || first->batch <= 0 || batched_outputs <= 0) return true;
+                int batch = 0;
+                for (auto &request : requests) {
+                    if (request == first || batchable(*first, *request)) batch += request->batch;
+                    if (batch >= max_batch_size) return true;
+                }
+                return false;
+            };
+            while (!ready()) {
+                if (cond.wait_until(_lock, deadline) == std::cv_status::timeout) break;
+            }
+
+            std::vector<BatchingRequest::shared> batch;
+            int batch_size = 0;
+            for (auto it = requests.begin(); it != requests.end();) {
+                auto &request = *it;
+                if (request != first) {
+                    if (!batchable(*first, *request) || batch_size + request->batch > max_batch_size) {
+                        ++it;
+                        continue;
+                    }
+                }
+                batch_size += request->batch;
+                batch.push_back(request);
+                it = requests.erase(it);
+                if (first->batch <= 0 || batched_outputs <= 0 || batch_size >= max_batch_size) break;
+            }
+            return batch;
+        }
+
+        std::vector<Tensor> launch(const std::vector<Tensor> &inputs) {
+            if (int(inputs.size()) != bench->input_count()) {
+                TS_LOG_ERROR << "Input count must be " << bench->input_count() << " vs. " << inputs.size() << " got." << eject;
+            }
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                bench->input(int(i), inputs[i]);
+            }
+            bench->run();
+            std::vector<Tensor> outputs;
+            auto output_count = bench->output_count();
+            for (int i = 0; i < output_count; ++i) {
+                outputs.push_back(bench->output(i));
+            }
+            return outputs;
+        }
+
+        void launch_alone(BatchingRequest &request) {
+            try {
+                auto outputs = launch(request.inputs);
+                if (request.batch > 0) learn(request, outputs);
+                request.outputs.set_value(std::move(outputs));
+            } catch (...) {
+                request.outputs.set_exception(std::current_exception());
+            }
+        }
+
+        /**
+         * learn if outputs are batched along dim 0, by outputs of request run alone
+         */
+        void learn(const BatchingRequest &request, const std::vector<Tensor> &outputs) {
+            if (batched_outputs < 0) return;
+            for (auto &output : outputs) {
+                if (output.packed() || output.dims() < 1 || output.size(0) != request.batch) {
+                    batched_outputs = -1;
+                    return;
+                }
+            }
+            batched_outputs = 1;
+            alone_input_shapes = trailing_shapes(request.inputs);
+            alone_output_shapes = trailing_shapes(outputs);
+        }
+
+        /**
+         * run batched requests, then split outputs
+         * @return false if batched outputs can not be split
+         */
+        bool launch_batched(const std::vector<BatchingRequest::shared> &batch) {
+            int batch_size = 0;
+            for (auto &request : batch) batch_size += request->batch;
+
+            std::vector<Tensor> inputs;
+            auto input_count = batch.front()->inputs.size();
+            for (size_t i = 0; i < input_count; ++i) {
+                std::vector<Tensor> values;
+                for (auto &request : batch) values.push_back(request->inputs[i]);
+                inputs.push_back(concat(values));
+            }
+
+            std::vector<Tensor> outputs;
+            try {
+                outputs = launch(inputs);
+            } catch (const Exception &e) {
+                TS_LOG_DEBUG << "Batched run failed, run one by one: " << e.what();
+                return false;
+            }
+            for (auto &output : outputs) {
+                if (output.packed() || output.dims() < 1 || output.size(0) != batch_size) return false;
+            }
+            // same inputs as learned except batch, so outputs must be same except batch
+            if (trailing_shapes(batch.front()->inputs) == alone_input_shapes &&
+                trailing_shapes(outputs) != alone_output_shapes) {
+                batched_outputs = -1;
+                return false;
+            }
+
+            std::vector<std::vector<Tensor>> scattered(batch.size());
+            int beg = 0;
+            for (size_t i = 0; i < batch.size(); ++i) {
+                auto end = beg + batch[i]->batch;
+                for (auto &output : outputs) {
+                    // slice borrows batched memory, so copy it out
+                    scattered[i].push_back(output.slice(beg, end).clone());
+                }
+                beg = end;
+            }
+            for (size_t i = 0; i < batch.size(); ++i) {
+                batch[i]->outputs.set_value(std::move(scattered[i]));
+            }
+            return true;
+        }
+
+        void launch(const std::vector<BatchingRequest::shared> &batch) {
+            if (batch.size() > 1) {
+                bool succeed = false;
+                try {
+                    succeed = launch_batched(batch);
+                } catch (...) {
+                    succeed = false;
+                }
+                if (succeed) return;
+            }
+            for (auto &request : batch) {
+                launch_alone(*request);
+            }
+        }
+    };
+
+    BatchingWorkbench::BatchingWorkbench(Workbench::shared bench, int max_batch_size, int timeout) {
+        if (bench == nullptr) {
+            TS_LOG_ERROR << "Can not batching on null workbench" << eject;
+        }
+        m_impl->bench = std::move(bench);
+        m_impl->max_batch_size = std::max(max_batch_size, 1);
+        m_impl->timeout = std::chrono::microseconds(std::max(timeout, 0));
+        m_impl->dispatcher = std::thread(&Implement::dispatch, m_impl.get());
+    }
+
+    BatchingWorkbench::~BatchingWorkbench() {
+        {
+            std::unique_lock<std::mutex> _lock(m_impl->mutex);
+            m_impl->running = false;
+            m_impl->cond.notify_all();
+        }
+        // waiting requests are still run before dispatcher exits
+        m_impl->dispatcher.join();
+    }
+
+    std::vector<Tensor> BatchingWorkbench::run(const std::vector<Tensor> &inputs) {
+        auto request = std::make_shared<BatchingRequest>();
+        request->inputs = inputs;
+        request->batch = batch_of(inputs);
+        request->arrival = std::chrono::steady_clock::now();
+        auto future = request->outputs.get_future();
+        {
+            std::unique_lock<std::mutex> _lock(m_impl->mutex);
+            if (!m_impl->running) {
+                TS_LOG_ERROR << "Can not run on stopped batching workbench" << eject;
+            }
+            m_impl->requests.push_back(request);
+            m_impl->cond.notify_all();
+        }
+        return future.get();
+    }
+
+    int BatchingWorkbench::max_batch_size() const {
+        return m_impl->max_batch_size;
+    }
+
+    int BatchingWorkbench::timeout() const {
+        return int(m_impl->timeout.count());
+    }
+
+    Workbench::shared BatchingWorkbench::workbench() const {
+        return m_impl->bench;
+    }
+}
@@ -0,0 +1,63 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/compute_pool.h"
+
+#include <algorithm>
+#include <thread>
+
+#ifdef TS_USE_OPENMP
+#include <omp.h>
+#endif
+
+namespace ts {
+    ComputePool::ComputePool(int core_budget)
+            : m_budget(std::max(core_budget, 1))
+            , m_available(m_budget) {
+        m_thread_pool = std::make_shared<ThreadPool>(m_budget);
+    }
+
+    int ComputePool::acquire(int cores) {
+        cores = std::max(cores, 1);
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        auto ticket = m_next_ticket++;
+        ++m_demand;
+        while (ticket != m_serving || m_available <= 0) m_cond.wait(_lock);
+        auto share = std::max(1, m_budget / m_demand);
+        auto leased = std::min(std::min(cores, share), m_available);
+        m_available -= leased;
+        ++m_serving;
+        m_cond.notify_all();
+        return leased;
+    }
+
+    void ComputePool::release(int cores) {
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        m_available += cores;
+        --m_demand;
+        m_cond.notify_all();
+    }
+
+    static std::mutex g_compute_pool_mutex;
+    static ComputePool::shared g_compute_pool;
+
+    void ComputePool::Setup(int core_budget) {
+        ComputePool::shared pool;
+        if (core_budget < 0) {
+#ifdef TS_USE_OPENMP
+            core_budget = omp_get_num_procs();
+#else
+            core_budget = int(std::thread::hardware_concurrency());
+#endif
+        }
+        if (core_budget != 0) pool = std::make_shared<ComputePool>(core_budget);
+        std::unique_lock<std::mutex> _lock(g_compute_pool_mutex);
+        g_compute_pool.swap(pool);
+    }
+
+    ComputePool::shared ComputePool::Global() {
+        std::unique_lock<std::mutex> _lock(g_compute_pool_mutex);
+        return g_compute_pool;
+    }
+}
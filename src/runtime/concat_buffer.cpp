@@ -0,0 +1,101 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/concat_buffer.h"
+
+namespace ts {
+    ConcatBuffer::ConcatBuffer(int dim)
+            : m_dim(dim) {}
+
+    bool ConcatBuffer::ready() const {
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        return m_ready;
+    }
+
+    bool ConcatBuffer::slice(Stack &stack, int i, Memory &slice) {
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        if (!m_ready) return false;
+        if (m_buffer.dtype() == VOID) {
+            m_buffer = stack.make(m_output, m_device);
+        }
+        auto buffer = m_buffer;
+        auto &input = m_inputs[i];
+        auto data = buffer.weak_memory().data<char>() + m_offsets[i];
+        slice = Memory(m_device, data, size_t(input.count() * input.type_bytes()));
+        slice.destructor([buffer]() {});
+        return true;
+    }
+
+    bool ConcatBuffer::take(const Stack &stack, int nargs, Tensor &output) {
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        // each buffer is used in one run
+        auto buffer = m_buffer;
+        m_buffer = Tensor();
+        if (!m_ready || buffer.dtype() == VOID) return false;
+        if (size_t(nargs) != m_inputs.size()) return false;
+
+        auto data = buffer.weak_memory().data<char>();
+        for (int i = 0; i < nargs; ++i) {
+            auto &x = stack[i];
+            if (x.packed() || x.device() != m_device || x.proto() != m_inputs[i]) return false;
+        }
+        for (int i = 0; i < nargs; ++i) {
+            if (stack[i].data() != data + m_offsets[i]) {
+                // same layout but not in slice, slices would be missed in each run
+                m_disabled = true;
+                m_ready = false;
+                return false;
+            }
+        }
+        output = buffer;
+        return true;
+    }
+
+    void ConcatBuffer::record(const Stack &stack, int nargs) {
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        m_ready = false;
+        if (m_disabled) return;
+        m_inputs.clear();
+        m_offsets.clear();
+        if (nargs < 2) return;
+
+        auto &first = stack[0];
+        auto dims = int(first.dims());
+        auto dim = m_dim >= 0 ? m_dim : dims + m_dim;
+        if (dim < 0 || dim >= dims) return;
+
+        Shape output_shape = first.sizes();
+        output_shape[dim] = 0;
+        size_t offset = 0;
+        for (int i = 0; i < nargs; ++i) {
+            auto &x = stack[i];
+            if (x.packed() || x.device() != first.device() || x.dtype() != first.dtype()) return;
+            if (int(x.dims()) != dims || x.count() == 0) return;
+            // slices are contiguous only if outer dims are 1
+            for (int j = 0; j < dim; ++j) {
+                if (x.size(j) != 1) return;
+            }
+            output_shape[dim] += x.size(dim);
+            m_inputs.push_back(x.proto());
+            m_offsets.push_back(offset);
+            offset += size_t(x.count() * x.proto().type_bytes());
+        }
+
+        m_device = first.device();
+        m_output = Tensor::Prototype(first.dtype(), output_shape);
+        m_ready = true;
+    }
+
+    ConcatBuffer::shared ConcatBuffer::clone() const {
+        auto dolly = std::make_shared<ConcatBuffer>(m_dim);
+        std::unique_lock<std::mutex> _lock(m_mutex);
+        dolly->m_ready = m_ready;
+        dolly->m_disabled = m_disabled;
+        dolly->m_device = m_device;
+        dolly->m_output = m_output;
+        dolly->m_inputs = m_inputs;
+        dolly->m_offsets = m_offsets;
+        return dolly;
+    }
+}
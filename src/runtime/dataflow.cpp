@@ -0,0 +1,138 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/dataflow.h"
+
+#include "runtime/program.h"
+#include "runtime/instruction/stack_instruction.h"
+#include "runtime/instruction/tensor_instruction.h"
+
+namespace ts {
+    /**
+     * stack of value indices, simulating Stack
+     */
+    class DataflowStack {
+    public:
+        std::vector<int> values;
+
+        bool absolute(int i, size_t &index) const {
+            auto size = int64_t(values.size());
+            auto fixed = i >= 0 ? int64_t(i) : size + i;
+            if (fixed < 0 || fixed > size) return false;
+            index = size_t(fixed);
+            return true;
+        }
+
+        bool at(int i, size_t &index) const {
+            return absolute(i, index) && index < values.size();
+        }
+    };
+
+    static bool simulate_stack_operation(DataflowStack &stack, const instruction::StackOperation &operation) {
+        auto &values = stack.values;
+        size_t i = 0, j = 0;
+        switch (operation.code()) {
+            default:
+                return false;
+            case instruction::StackOperation::PUSH:
+                if (!stack.at(operation.arg0(), i)) return false;
+                values.push_back(values[i]);
+                return true;
+            case instruction::StackOperation::ERASE:
+                if (!stack.at(operation.arg0(), i)) return false;
+                values.erase(values.begin() + i);
+                return true;
+            case instruction::StackOperation::ERASE_RANGE:
+                if (!stack.absolute(operation.arg0(), i) || !stack.absolute(operation.arg1(), j)) return false;
+                if (i > j) return false;
+                values.erase(values.begin() + i, values.begin() + j);
+                return true;
+            case instruction::StackOperation::RING_SHIFT_LEFT:
+                if (values.empty()) return false;
+                values.push_back(values.front());
+                values.erase(values.begin());
+                return true;
+            case instruction::StackOperation::SWAP:
+                if (!stack.at(operation.arg0(), i) || !stack.at(operation.arg1(), j)) return false;
+                std::swap(values[i], values[j]);
+                return true;
+        }
+    }
+
+    Dataflow::shared Dataflow::Analyse(const Program &program) {
+        auto dataflow = std::make_shared<Dataflow>();
+        auto &values = dataflow->m_values;
+        auto &nodes = dataflow->m_nodes;
+
+        DataflowStack stack;
+        auto new_value = [&](Value::Kind kind, int index) {
+            Value value;
+            value.kind = kind;
+            value.index = index;
+            values.push_back(value);
+            stack.values.push_back(int(values.size() - 1));
+        };
+
+        auto input_count = program.input_count();
+        for (int i = 0; i < input_count; ++i) {
+            new_value(Value::ARGUMENT, i);
+        }
+
+        for (auto &inst : program.instruction()) {
+            auto data = dynamic_cast<DataSegmentInstruction *>(inst.get());
+            if (data) {
+                new_value(Value::DATA, data->data_index());
+                continue;
+            }
+            auto operation = dynamic_cast<instruction::StackOperation *>(inst.get());
+            if (operation) {
+                if (!simulate_stack_operation(stack, *operation)) return nullptr;
+                continue;
+            }
+            // instructions consume nargs values, then produce one value
+            size_t nargs = 0;
+            bool view = false;
+            if (auto op = dynamic_cast<OperatorInstruction *>(inst.get())) {
+                if (op->nargs() < 0 || op->nresults() != 1) return nullptr;
+                nargs = size_t(op->nargs());
+                view = op->is_view();
+            } else if (auto pack = dynamic_cast<instruction::PackInstruction *>(inst.get())) {
+                nargs = pack->size();
+            } else if (dynamic_cast<instruction::FieldInstruction *>(inst.get())) {
+                nargs = 1;
+            } else {
+                return nullptr;
+            }
+            if (stack.values.size() < nargs) return nullptr;
+
+            Node node;
+            node.instruction = std::static_pointer_cast<StackInstruction>(inst);
+            node.view = view;
+            node.inputs.assign(stack.values.end() - nargs, stack.values.end());
+            stack.values.resize(stack.values.size() - nargs);
+            nodes.push_back(node);
+            new_value(Value::RESULT, int(nodes.size() - 1));
+            nodes.back().output = stack.values.back();
+        }
+
+        if (stack.values.size() != size_t(program.output_count())) return nullptr;
+        dataflow->m_outputs = stack.values;
+
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto &node = nodes[i];
+            for (auto input : node.inputs) {
+                auto &value = values[input];
+                ++value.uses;
+                if (value.kind != Value::RESULT) continue;
+                nodes[value.index].next.push_back(int(i));
+                ++node.depends;
+            }
+        }
+        for (auto output : dataflow->m_outputs) {
+            ++values[output].uses;
+        }
+
+        return dataflow;
+    }
+}
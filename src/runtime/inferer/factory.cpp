@@ -317,6 +317,19 @@ namespace ts {
         TS_STATIC_ACTION(ShapeInferer::Register, "mul", _eltwise)
         TS_STATIC_ACTION(ShapeInferer::Register, "div", _eltwise)
 
+        static TensorPrototype _fused_elementwise(const Node &node, const std::vector<TensorPrototype> &inputs) {
+            if (inputs.empty()) return VOID;
+
+            auto out = inputs[0];
+            for (size_t i = 1; i < inputs.size(); ++i) {
+                out = _eltwise(node, {out, inputs[i]});
+            }
+
+            return out;
+        }
+
+        TS_STATIC_ACTION(ShapeInferer::Register, "_fused_elementwise", _fused_elementwise)
+
         static TensorPrototype flatten(const Node &node, const std::vector<TensorPrototype> &inputs) {
             auto &x = inputs[0];
 
@@ -4,124 +4,386 @@
 
 #include "runtime/inside/thread_pool.h"
 #include "utils/ctxmgr_lite_support.h"
+#include "utils/cpu.h"
 
-namespace ts {
+#include <unordered_map>
+#include <chrono>
+#include <algorithm>
 
-    Thread::Thread()
-            : is_running(true), task(nullptr), after_task(nullptr) {
-        this->core = std::thread(&Thread::operating, this);
-    }
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
 
-    Thread::~Thread() {
-        is_running = false;
-        task_cond.notify_all();
-        core.join();
+namespace ts {
+    static inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif (defined(__aarch64__) || defined(__arm__)) && defined(__GNUC__)
+        __asm__ __volatile__("yield");
+#else
+        std::this_thread::yield();
+#endif
     }
 
-    void Thread::run(int signet, const Thread::task_type &task, const Thread::after_task_type &after_task) {
-        std::unique_lock<std::mutex> locker(task_mutex);
-        this->signet = signet;
-        this->task = task;
-        this->after_task = after_task;
-        task_cond.notify_all();
+    /**
+     * busy polling until condition satisfied or time out
+     * @return false if time out
+     */
+    template <typename Condition>
+    static inline bool spin_wait(int microseconds, Condition condition) {
+        if (microseconds <= 0) return false;
+        using clock = std::chrono::steady_clock;
+        auto deadline = clock::now() + std::chrono::microseconds(microseconds);
+        for (unsigned int count = 1; ; ++count) {
+            if (condition()) return true;
+            cpu_relax();
+            if ((count & 0x3F) == 0 && clock::now() >= deadline) return false;
+        }
     }
 
-    bool Thread::busy() {
-        if (!task_mutex.try_lock()) return false;
-        bool is_busy = task != nullptr;
-        task_mutex.unlock();
-        return is_busy;
-    }
+    /**
+     * task pushed in pool
+     */
+    class PoolTask {
+    public:
+        using self = PoolTask;
 
-    void Thread::join() {
-        std::unique_lock<std::mutex> locker(task_mutex);
-        while (task) task_cond.wait(locker);
-    }
+        ThreadPool::task_type task;
+        ThreadPool::after_task_type after_task;
+        ThreadPool::Group *group = nullptr;
+    };
+
+    /**
+     * Chase-Lev deque, owner pushes and pops at bottom, others steal at top.
+     * Fixed capacity, push fails if full.
+     */
+    class TaskDeque {
+    public:
+        using self = TaskDeque;
+
+        explicit TaskDeque(size_t capacity_log2 = 10)
+                : m_mask((int64_t(1) << capacity_log2) - 1)
+                , m_buffer(new std::atomic<PoolTask *>[size_t(1) << capacity_log2]) {
+        }
+
+        bool push(PoolTask *task) {
+            auto bottom = m_bottom.load(std::memory_order_relaxed);
+            auto top = m_top.load(std::memory_order_acquire);
+            if (bottom - top > m_mask) return false;
+            m_buffer[bottom & m_mask].store(task, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        PoolTask *pop() {
+            auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            auto task = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // last one, race with thieves
+                if (!m_top.compare_exchange_strong(top, top + 1,
+                                                   std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        PoolTask *steal() {
+            auto top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom) return nullptr;
+            auto task = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return task;
+        }
+
+    private:
+        int64_t m_mask;
+        std::unique_ptr<std::atomic<PoolTask *>[]> m_buffer;
+        std::atomic<int64_t> m_top{0};
+        std::atomic<int64_t> m_bottom{0};
+    };
+
+    class PoolWorker {
+    public:
+        using self = PoolWorker;
+
+        TaskDeque deque;
+        ThreadPool::Group group;    ///< tasks pushed by this worker without group
+        std::thread core;
+    };
+
+    class ThreadPool::Implement {
+    public:
+        using self = Implement;
+
+        std::vector<std::unique_ptr<PoolWorker>> workers;
+
+        std::mutex inject_mutex;            ///< tasks pushed by threads out of pool
+        std::deque<PoolTask *> inject;
+
+        std::atomic<int> queued{0};         ///< tasks not taken by any thread
+        std::atomic<int> unfinished{0};     ///< tasks not finished
+        std::atomic<int> sleeping{0};
+        std::atomic<bool> running{true};
+        std::atomic<int> spin_wait_time{0};     ///< microseconds
+
+        std::mutex affinity_mutex;
+        std::vector<int> affinity;
+        std::atomic<int> affinity_version{0};
+
+        void bind_affinity(int signet, int &version) {
+            auto latest = affinity_version.load();
+            if (version == latest) return;
+            int cpu_id = -1;
+            {
+                std::unique_lock<std::mutex> _lock(affinity_mutex);
+                if (!affinity.empty()) cpu_id = affinity[signet % affinity.size()];
+                latest = affinity_version.load();
+            }
+            CpuEnable::bind_thread(cpu_id);
+            version = latest;
+        }
+        std::mutex sleep_mutex;
+        std::condition_variable sleep_cond;
+
+        std::mutex groups_mutex;            ///< groups of threads out of pool, erased when joined
+        std::unordered_map<std::thread::id, std::unique_ptr<Group>> groups;
 
-    void Thread::operating() {
-        std::unique_lock<std::mutex> locker(task_mutex);
-        while (is_running) {
-            while (is_running && !task) task_cond.wait(locker);
-            if (!is_running) break;
-            task(signet);
-            if (after_task) after_task(signet);
-            task = nullptr;
-            after_task = nullptr;
-            task_cond.notify_all();
+        PoolTask *take(int signet) {
+            PoolTask *task = nullptr;
+            if (signet >= 0) task = workers[signet]->deque.pop();
+            if (task == nullptr) {
+                std::unique_lock<std::mutex> _lock(inject_mutex);
+                if (!inject.empty()) {
+                    task = inject.front();
+                    inject.pop_front();
+                }
+            }
+            if (task == nullptr) {
+                auto size = int(workers.size());
+                for (int i = 1; i <= size && task == nullptr; ++i) {
+                    auto victim = (signet + i) % size;
+                    if (victim == signet) continue;
+                    task = workers[victim]->deque.steal();
+                }
+            }
+            if (task != nullptr) --queued;
+            return task;
+        }
+
+        void push(int signet, PoolTask *task) {
+            ++unfinished;
+            if (signet >= 0) {
+                if (!workers[signet]->deque.push(task)) {
+                    // deque full, run it now
+                    execute(signet, task);
+                    return;
+                }
+            } else {
+                std::unique_lock<std::mutex> _lock(inject_mutex);
+                inject.push_back(task);
+            }
+            ++queued;
+            if (sleeping.load() > 0) {
+                std::unique_lock<std::mutex> _lock(sleep_mutex);
+                sleep_cond.notify_one();
+            }
+        }
+
+        void execute(int signet, PoolTask *task) {
+            std::unique_ptr<PoolTask> _task(task);
+            std::exception_ptr exception;
+            try {
+                task->task(signet);
+                if (task->after_task) task->after_task(signet);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            --unfinished;
+            auto group = task->group;
+            std::unique_lock<std::mutex> _lock(group->mutex);
+            if (exception && !group->exception) group->exception = exception;
+            if (--group->pending == 0) group->cond.notify_all();
+        }
+
+        void operating(ThreadPool *pool, int signet);
+
+        Group &implicit_group(int signet) {
+            if (signet >= 0) return workers[signet]->group;
+            std::unique_lock<std::mutex> _lock(groups_mutex);
+            auto &group = groups[std::this_thread::get_id()];
+            if (!group) group.reset(new Group);
+            return *group;
+        }
+    };
+
+    /**
+     * pool and index of working thread
+     */
+    static thread_local const void *tls_pool = nullptr;
+    static thread_local int tls_signet = -1;
+
+    void ThreadPool::Implement::operating(ThreadPool *pool, int signet) {
+        tls_pool = this;
+        tls_signet = signet;
+        // bind pool, so tasks can run nested tasks
+        ctx::bind<ThreadPool> _bind_pool(pool);
+        int bound_affinity_version = 0;
+        while (true) {
+            bind_affinity(signet, bound_affinity_version);
+            auto task = take(signet);
+            if (task != nullptr) {
+                execute(signet, task);
+                continue;
+            }
+            // keep hot for next task, before blocking
+            if (spin_wait(spin_wait_time.load(std::memory_order_relaxed), [&]() {
+                return !running || (queued.load() > 0 && (task = take(signet)) != nullptr);
+            }) && task != nullptr) {
+                execute(signet, task);
+                continue;
+            }
+            std::unique_lock<std::mutex> _lock(sleep_mutex);
+            ++sleeping;
+            while (running && queued.load() <= 0) sleep_cond.wait(_lock);
+            --sleeping;
+            if (!running && queued.load() <= 0) break;
         }
     }
 
-    ThreadPool::ThreadPool(size_t pool_size)
-            : thread_pool(pool_size) {
+    ThreadPool::ThreadPool(size_t pool_size) {
+        m_impl->workers.resize(pool_size);
+        for (auto &worker : m_impl->workers) {
+            worker.reset(new PoolWorker);
+        }
         for (int i = 0; i < static_cast<int>(pool_size); ++i) {
-            thread_pool[i] = new Thread();
-            running_core.push_back(i);   // push all cartridge into chest
+            m_impl->workers[i]->core = std::thread(&Implement::operating, m_impl.get(), this, i);
         }
     }
 
     ThreadPool::~ThreadPool() {
-        for (int i = 0; i < static_cast<int>(thread_pool.size()); ++i) {
-            delete thread_pool[i];
+        {
+            std::unique_lock<std::mutex> _lock(m_impl->sleep_mutex);
+            m_impl->running = false;
+            m_impl->sleep_cond.notify_all();
+        }
+        for (auto &worker : m_impl->workers) {
+            worker->core.join();
         }
     }
 
-    Thread *ThreadPool::run(const Thread::task_type &task) {
-        if (thread_pool.size() == 0) {
+    int ThreadPool::signet() const {
+        return tls_pool == m_impl.get() ? tls_signet : -1;
+    }
+
+    void ThreadPool::run(Group &group, const task_type &task) {
+        if (m_impl->workers.empty()) {
             task(0);
-            return nullptr;
-        } else {
-            int signet = load();
-            Thread *cart = this->thread_pool[signet];
-            cart->run(signet, task,
-                      Thread::after_task_type(std::bind(&ThreadPool::recycling_thread, this, std::placeholders::_1)));
-            return cart;
+            return;
         }
+        auto pool_task = new PoolTask;
+        pool_task->task = task;
+        pool_task->group = &group;
+        ++group.pending;
+        m_impl->push(signet(), pool_task);
+    }
 
+    void ThreadPool::run(const task_type &task) {
+        run(m_impl->implicit_group(signet()), task);
     }
 
-    Thread *ThreadPool::run(const Thread::task_type &task, const Thread::after_task_type &after_task) {
-        if (thread_pool.size() == 0) {
+    void ThreadPool::run(const task_type &task, const after_task_type &after_task) {
+        if (m_impl->workers.empty()) {
             task(0);
-            return nullptr;
-        } else {
-            int signet = load();
-            Thread *cart = this->thread_pool[signet];
-            cart->run(signet, task, [this, after_task](int id) -> void {
-                after_task(id);
-                this->recycling_thread(id);
-            });
-            return cart;
+            after_task(0);
+            return;
         }
+        auto &group = m_impl->implicit_group(signet());
+        auto pool_task = new PoolTask;
+        pool_task->task = task;
+        pool_task->after_task = after_task;
+        pool_task->group = &group;
+        ++group.pending;
+        m_impl->push(signet(), pool_task);
     }
 
-    int ThreadPool::load() {
-        std::unique_lock<std::mutex> locker(running_core_mutex);
-        while (this->running_core.empty()) running_core_cond.wait(locker);
-        int signet = this->running_core.front();
-        this->running_core.pop_front();
-        return signet;
+    void ThreadPool::join(Group &group) {
+        auto signet = this->signet();
+        if (signet >= 0) {
+            // working thread keeps running tasks, so nested tasks never dead lock
+            while (group.pending.load() > 0) {
+                auto task = m_impl->take(signet);
+                if (task != nullptr) {
+                    m_impl->execute(signet, task);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        spin_wait(m_impl->spin_wait_time.load(std::memory_order_relaxed), [&]() {
+            return group.pending.load() == 0;
+        });
+        std::unique_lock<std::mutex> _lock(group.mutex);
+        while (group.pending.load() > 0) group.cond.wait(_lock);
+        if (group.exception) {
+            auto exception = group.exception;
+            group.exception = nullptr;
+            std::rethrow_exception(exception);
+        }
     }
 
     void ThreadPool::join() {
-        std::unique_lock<std::mutex> locker(running_core_mutex);
-        while (this->running_core.size() != this->thread_pool.size()) running_core_cond.wait(locker);
+        auto signet = this->signet();
+        if (signet >= 0) {
+            join(m_impl->workers[signet]->group);
+            return;
+        }
+        // group of thread out of pool is dropped once joined, so finished threads leave nothing behind
+        std::unique_ptr<Group> group;
+        {
+            std::unique_lock<std::mutex> _lock(m_impl->groups_mutex);
+            auto it = m_impl->groups.find(std::this_thread::get_id());
+            if (it == m_impl->groups.end()) return;
+            group = std::move(it->second);
+            m_impl->groups.erase(it);
+        }
+        join(*group);
     }
 
     bool ThreadPool::busy() {
-        if (!running_core_mutex.try_lock()) return false;
-        bool is_busy = this->running_core.size() != this->thread_pool.size();
-        running_core_mutex.unlock();
-        return is_busy;
+        return m_impl->unfinished.load() > 0;
     }
 
-    size_t ThreadPool::size() const {
-        return thread_pool.size();
+    void ThreadPool::set_spin_wait_time(int microseconds) {
+        m_impl->spin_wait_time = std::max(microseconds, 0);
+    }
+
+    int ThreadPool::get_spin_wait_time() const {
+        return m_impl->spin_wait_time.load();
     }
 
-    void ThreadPool::recycling_thread(int signet) {
-        std::unique_lock<std::mutex> locker(running_core_mutex);
-        this->running_core.push_front(signet);
-        running_core_cond.notify_all();
+    void ThreadPool::set_cpu_affinity(const std::vector<int> &cpu_ids) {
+        std::unique_lock<std::mutex> _lock(m_impl->affinity_mutex);
+        m_impl->affinity = cpu_ids;
+        ++m_impl->affinity_version;
+    }
+
+    size_t ThreadPool::size() const {
+        return m_impl->workers.size();
     }
 }
 
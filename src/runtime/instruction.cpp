@@ -31,9 +31,7 @@ namespace ts {
         return profiler_serial_timer(oss.str());
     }
 
-    void OperatorInstruction::run(Workbench &workbench) {
-        auto &stack = workbench.stack();
-
+    void OperatorInstruction::run(Stack &stack) {
         TS_AUTO_CHECK(stack.size() >= static_cast<size_t>(m_nargs));
 
         // save base
@@ -47,13 +45,27 @@ namespace ts {
         };
 #endif
 
+        // write output into slice of concat buffer
+        if (m_concat_slice) {
+            Memory slice;
+            if (m_concat_slice->slice(stack, m_concat_slice_index, slice)) stack.preset(slice);
+        }
+        ts::need clear_preset(&Stack::clear_preset, &stack);
+
         // call function
         int return_size = 0;
         {
 #ifdef TS_USE_PROFILER
             auto _timer = profiler_run(this->m_func);
 #endif
-            return_size = m_func->run(stack);
+            Tensor output;
+            if (m_concat_buffer && m_concat_buffer->take(stack, m_nargs, output)) {
+                stack.push(output);
+                return_size = 1;
+            } else {
+                return_size = m_func->run(stack);
+                if (m_concat_buffer) m_concat_buffer->record(stack, m_nargs);
+            }
         }
 
         (void)(return_size);
@@ -99,6 +111,11 @@ namespace ts {
         op->init();
         auto dolly = std::make_shared<OperatorInstruction>(op, m_nargs, m_nresults, m_description);
         dolly->m_creator = m_creator;
+        dolly->m_view = m_view;
+        // concat buffers are shared until program rebinds them, see Program::clone
+        dolly->m_concat_buffer = m_concat_buffer;
+        dolly->m_concat_slice = m_concat_slice;
+        dolly->m_concat_slice_index = m_concat_slice_index;
         return std::move(dolly);
     }
 
@@ -9,46 +9,71 @@
 namespace ts {
     namespace instruction {
         Instruction::shared Stack::push(int i) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                workbench.stack().push(i);
-            }, "push(" + std::to_string(i) + ")");
+            return std::make_shared<StackOperation>(StackOperation::PUSH, i, 0,
+                    "push(" + std::to_string(i) + ")");
         }
 
         Instruction::shared Stack::clone(int i) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                workbench.stack().clone(i);
-            }, "clone(" + std::to_string(i) + ")");
+            return std::make_shared<StackOperation>(StackOperation::CLONE, i, 0,
+                    "clone(" + std::to_string(i) + ")");
         }
 
         Instruction::shared Stack::erase(int i) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                workbench.stack().erase(i);
-            }, "erase(" + std::to_string(i) + ")");
+            return std::make_shared<StackOperation>(StackOperation::ERASE, i, 0,
+                    "erase(" + std::to_string(i) + ")");
         }
 
         Instruction::shared Stack::ring_shift_left() {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                auto &stack = workbench.stack();
-                stack.push(0);
-                stack.erase(0);
-            }, "<<<(" + std::to_string(1) + ")");
+            return std::make_shared<StackOperation>(StackOperation::RING_SHIFT_LEFT, 0, 0,
+                    "<<<(" + std::to_string(1) + ")");
         }
 
         Instruction::shared Stack::swap(int i, int j) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                auto &stack = workbench.stack();
-                auto ti = *stack.index(i);
-                auto tj = *stack.index(j);
-                *stack.index(i) = tj;
-                *stack.index(j) = ti;
-            }, "swap(" + std::to_string(i) + ", " + std::to_string(j) + ")");
+            return std::make_shared<StackOperation>(StackOperation::SWAP, i, j,
+                    "swap(" + std::to_string(i) + ", " + std::to_string(j) + ")");
         }
 
         Instruction::shared Stack::erase(int beg, int end) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench){
-                workbench.stack().erase(beg, end);
-            }, "erase(" + std::to_string(beg) + ", " + std::to_string(end) + ")");
+            return std::make_shared<StackOperation>(StackOperation::ERASE_RANGE, beg, end,
+                    "erase(" + std::to_string(beg) + ", " + std::to_string(end) + ")");
+        }
+
+        StackOperation::StackOperation(Code code, int arg0, int arg1, const std::string &description)
+                : m_code(code), m_arg0(arg0), m_arg1(arg1), m_description(description) {
+        }
+
+        void StackOperation::run(ts::Stack &stack) {
+            switch (m_code) {
+                case PUSH:
+                    stack.push(m_arg0);
+                    break;
+                case CLONE:
+                    stack.clone(m_arg0);
+                    break;
+                case ERASE:
+                    stack.erase(m_arg0);
+                    break;
+                case ERASE_RANGE:
+                    stack.erase(m_arg0, m_arg1);
+                    break;
+                case RING_SHIFT_LEFT:
+                    stack.push(0);
+                    stack.erase(0);
+                    break;
+                case SWAP: {
+                    auto ti = *stack.index(m_arg0);
+                    auto tj = *stack.index(m_arg1);
+                    *stack.index(m_arg0) = tj;
+                    *stack.index(m_arg1) = ti;
+                    break;
+                }
+            }
+        }
+
+        std::string StackOperation::str() const {
+            std::ostringstream oss;
+            oss << "<Lambda: " << m_description << ">";
+            return oss.str();
         }
     }
 }
-
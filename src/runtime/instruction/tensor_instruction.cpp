@@ -15,33 +15,56 @@
 namespace ts {
     namespace instruction {
         Instruction::shared Tensor::pack(size_t size) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench) {
-                auto &stack = workbench.stack();
-                if (stack.size() < size) {
-                    TS_LOG(LOG_ERROR) << "Can not pack " << size << "tensor(s) on stack(size=" << stack.size() << ")"
-                                      << eject;
-                }
-                std::vector<ts::Tensor> fields;
-                fields.reserve(size);
-                int anchor = -int(size);
-                while (anchor < 0) {
-                    fields.emplace_back(*stack.index(anchor));
-                    ++anchor;
-                }
-                ts::Tensor packed_tensor;
-                packed_tensor.pack(fields);
-                stack.pop(size);
-                stack.push(packed_tensor);
-            }, "pack(" + std::to_string(size) + ")");
+            return std::make_shared<PackInstruction>(size);
         }
 
         Instruction::shared Tensor::field(int index) {
-            return std::make_shared<LambdaInstruction>([=](Workbench &workbench) {
-                auto &stack = workbench.stack();
-                auto field = stack.top()->field(index);
-                stack.pop();
-                stack.push(field);
-            }, "field(" + std::to_string(index) + ")");
+            return std::make_shared<FieldInstruction>(index);
+        }
+
+        PackInstruction::PackInstruction(size_t size)
+                : m_size(size) {
+        }
+
+        void PackInstruction::run(ts::Stack &stack) {
+            auto size = m_size;
+            if (stack.size() < size) {
+                TS_LOG(LOG_ERROR) << "Can not pack " << size << "tensor(s) on stack(size=" << stack.size() << ")"
+                                  << eject;
+            }
+            std::vector<ts::Tensor> fields;
+            fields.reserve(size);
+            int anchor = -int(size);
+            while (anchor < 0) {
+                fields.emplace_back(*stack.index(anchor));
+                ++anchor;
+            }
+            ts::Tensor packed_tensor;
+            packed_tensor.pack(fields);
+            stack.pop(size);
+            stack.push(packed_tensor);
+        }
+
+        std::string PackInstruction::str() const {
+            std::ostringstream oss;
+            oss << "<Lambda: pack(" << m_size << ")>";
+            return oss.str();
+        }
+
+        FieldInstruction::FieldInstruction(int index)
+                : m_index(index) {
+        }
+
+        void FieldInstruction::run(ts::Stack &stack) {
+            auto field = stack.top()->field(m_index);
+            stack.pop();
+            stack.push(field);
+        }
+
+        std::string FieldInstruction::str() const {
+            std::ostringstream oss;
+            oss << "<Lambda: field(" << m_index << ")>";
+            return oss.str();
         }
 
         static std::vector<Instruction::shared> create_instruction_field(const Node &node) {
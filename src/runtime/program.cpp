@@ -10,6 +10,9 @@
 #include "core/tensor_builder.h"
 #include "core/device_context.h"
 #include "global/memory_device.h"
+#include "module/io/mstream.h"
+
+#include <unordered_map>
 
 namespace ts {
     static std::string fuzzy_name(const Program::map<std::string, int> &map_name_slot, const std::string &name) {
@@ -51,8 +54,21 @@ namespace ts {
         }
     }
 
+    /**
+     * @return true if data is on memory_device and in mapped module file
+     */
+    static bool is_mapped(const DeviceTensor &data, const MemoryDevice &memory_device) {
+        if (!data.device.empty()) return false;
+        for (auto &field : data.tensor.unpack()) {
+            if (field.device() != memory_device) return false;
+            if (!MappedStreamReader::Mapped(field.data())) return false;
+        }
+        return true;
+    }
+
     Program::shared Program::Compile(const Module::shared &module, const ComputingDevice &device, const std::string &options) {
         Program::shared program(new Program(device));
+        program->m_options = options;
         // translate module
         auto translated_module = Module::Translate(module, device, options);
         // TODO: support RNN
@@ -82,11 +98,21 @@ namespace ts {
 
         ArgParser parser;
         parser.add({"--filter", "-flt"}, {"--no-filter", "-no-flt"}, false);
+        parser.add({"--plan-memory", "-plan"}, {"--no-plan-memory", "-no-plan"}, false);
+        parser.add({"--registers", "-reg"}, {"--no-registers", "-no-reg"}, false);
         parser.parse(options);
         auto do_filter = parser.get("--filter");
+        program->m_plan_memory = parser.get("--plan-memory");
+        program->m_register_form = parser.get("--registers");
 
+        auto memory_device = ComputingMemory::Query(device);
         for (auto &data : block.data_segment) {
             Tensor *value = nullptr;
+            if (!do_filter && is_mapped(data, memory_device)) {
+                // keep view of mapped module file, instead of private copy
+                program->m_data_segment->push(data.tensor);
+                continue;
+            }
             if (data.device.empty()) {
                 value = program->m_data_segment->clone_push(data.tensor);
             } else {
@@ -143,6 +169,7 @@ namespace ts {
         std::unique_lock<std::mutex> _lock_clone(*this->m_mutex);
 
         Program::shared dolly(new Program(this->m_device, this->m_mutex));
+        dolly->m_options = this->m_options;
         dolly->m_program = this->m_program;
         // dolly->m_inputs.resize(this->m_inputs.size());
         // dolly->m_outputs.resize(this->m_outputs.size());
@@ -160,19 +187,56 @@ namespace ts {
         DeviceContext device_context(m_device);
         ctx::bind<DeviceContext> bind_device_context(device_context);
 
+        // each program has own concat buffers, holding buffer of running
+        std::unordered_map<ConcatBuffer *, ConcatBuffer::shared> cloned_buffers;
+        auto clone_buffer = [&](const ConcatBuffer::shared &buffer) {
+            auto &cloned = cloned_buffers[buffer.get()];
+            if (cloned == nullptr) cloned = buffer->clone();
+            return cloned;
+        };
+
         for (auto &instruction : dolly->m_program) {
             auto op = dynamic_cast<OperatorInstruction*>(instruction.get());
             if (op == nullptr) continue;
-            instruction = op->clone();
+            auto cloned = op->clone();
+            if (cloned->concat_buffer()) {
+                cloned->bind_concat_buffer(clone_buffer(cloned->concat_buffer()));
+            }
+            if (cloned->concat_slice()) {
+                cloned->bind_concat_slice(clone_buffer(cloned->concat_slice()), cloned->concat_slice_index());
+            }
+            instruction = cloned;
         }
 
         // copy dtype
         dolly->m_input_dtypes = m_input_dtypes;
         dolly->m_output_dtypes = m_output_dtypes;
 
+        // share memory plans
+        dolly->m_plan_memory = m_plan_memory;
+        dolly->m_register_form = m_register_form;
+        dolly->m_memory_plans = m_memory_plans;
+
         return std::move(dolly);
     }
 
+    Program::shared Program::replicate() const {
+        auto dolly = this->clone();
+        auto memory_device = ComputingMemory::Query(m_device);
+        dolly->m_data_segment = std::make_shared<Stack>(memory_device, DynamicSyncMemoryController::Make(memory_device, true));
+        auto size = this->m_data_segment->size();
+        for (size_t i = 0; i < size; ++i) {
+            auto &tensor = *this->m_data_segment->index(int(i));
+            // only CPU memory is placed on NUMA node
+            if (tensor.device().type() == CPU) {
+                dolly->m_data_segment->clone_push(tensor, tensor.device());
+            } else {
+                dolly->m_data_segment->push(tensor);
+            }
+        }
+        return dolly;
+    }
+
     Program::Program(const ComputingDevice &device)
         : self(device, std::make_shared<std::mutex>()) {
     }
@@ -181,6 +245,8 @@ namespace ts {
         : m_device(device), m_mutex(mutex) {
         auto memory_device = ComputingMemory::Query(m_device);
 
+        this->m_memory_plans = std::make_shared<MemoryPlanCache>();
+
         this->m_data_segment = std::make_shared<Stack>(memory_device, DynamicSyncMemoryController::Make(memory_device, true));
     }
 
@@ -278,4 +344,34 @@ namespace ts {
     const std::vector<std::string> &Program::output_names() const {
         return m_output_names;
     }
-}
\ No newline at end of file
+
+    MemoryPlan::shared Program::memory_plan(const std::string &signature) const {
+        std::unique_lock<std::mutex> _lock(m_memory_plans->mutex);
+        auto it = m_memory_plans->plans.find(signature);
+        if (it == m_memory_plans->plans.end()) return nullptr;
+        return it->second;
+    }
+
+    void Program::memory_plan(const std::string &signature, MemoryPlan::shared plan) {
+        std::unique_lock<std::mutex> _lock(m_memory_plans->mutex);
+        if (plan == nullptr) {
+            m_memory_plans->plans.erase(signature);
+        } else {
+            m_memory_plans->plans[signature] = std::move(plan);
+        }
+    }
+
+    Dataflow::shared Program::dataflow() const {
+        std::call_once(m_dataflow_once, [this]() {
+            m_dataflow = Dataflow::Analyse(*this);
+        });
+        return m_dataflow;
+    }
+
+    RegisterProgram::shared Program::register_program() const {
+        std::call_once(m_register_program_once, [this]() {
+            m_register_program = RegisterProgram::Compile(dataflow());
+        });
+        return m_register_program;
+    }
+}
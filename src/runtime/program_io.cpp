@@ -0,0 +1,405 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/program.h"
+
+#include "runtime/instruction/stack_instruction.h"
+#include "runtime/instruction/tensor_instruction.h"
+#include "runtime/workbench.h"
+#include "module/header.h"
+#include "module/io/fstream.h"
+#include "module/io/mstream.h"
+#include "global/operator_factory.h"
+#include "global/memory_device.h"
+#include "core/device_context.h"
+#include "utils/box.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef TS_LIBRARY_VERSION
+#define TS_LIBRARY_VERSION "unknown"
+#endif
+
+namespace ts {
+    /**
+     * kind of saved instruction
+     */
+    enum class SavedInstruction : uint8_t {
+        STACK = 0,
+        PACK = 1,
+        FIELD = 2,
+        DATA = 3,
+        OPERATOR = 4,
+    };
+
+    static size_t write_string(StreamWriter &stream, const std::string &str) {
+        size_t writen_size = 0;
+        writen_size += binio::write<uint32_t>(stream, uint32_t(str.size()));
+        writen_size += binio::write<char>(stream, str.data(), str.size());
+        return writen_size;
+    }
+
+    static size_t read_string(StreamReader &stream, std::string &str) {
+        size_t read_size = 0;
+        uint32_t size_buffer = 0;
+        read_size += binio::read<uint32_t>(stream, size_buffer);
+        std::vector<char> string_buffer(size_buffer);
+        read_size += binio::read<char>(stream, string_buffer.data(), size_buffer);
+        str = std::string(string_buffer.begin(), string_buffer.end());
+        return read_size;
+    }
+
+    /**
+     * options split by space, so same options with different spaces are same key
+     */
+    static std::string normalize_options(const std::string &options) {
+        std::string normalized;
+        for (auto &option : Split(options, " \t\r\n")) {
+            if (option.empty()) continue;
+            if (!normalized.empty()) normalized += " ";
+            normalized += option;
+        }
+        return normalized;
+    }
+
+    /**
+     * key is library version, format version, device and options, program can only be loaded with same key
+     */
+    static void write_key(StreamWriter &stream, const ComputingDevice &device, const std::string &options) {
+        write_string(stream, TS_LIBRARY_VERSION);
+        binio::write<int32_t>(stream, int32_t(TS_PROGRAM_FORMAT_VERSION));
+        write_string(stream, device.type().std());
+        binio::write<int32_t>(stream, int32_t(device.id()));
+        write_string(stream, normalize_options(options));
+    }
+
+    static void write_operator(StreamWriter &stream, const OperatorInstruction &inst,
+                               const std::unordered_map<ConcatBuffer *, int32_t> &buffer_index) {
+        auto op = inst.op();
+        binio::write<int32_t>(stream, int32_t(inst.nargs()));
+        binio::write<int32_t>(stream, int32_t(inst.nresults()));
+        binio::write<uint8_t>(stream, uint8_t(inst.is_view()));
+        write_string(stream, inst.description());
+        write_string(stream, op->op());
+
+        auto &params = op->params();
+        binio::write<uint32_t>(stream, uint32_t(params.size()));
+        for (auto &param : params) {
+            write_string(stream, param.first);
+            param.second.serialize(stream);
+        }
+
+        auto index_of = [&](const ConcatBuffer::shared &buffer) {
+            return buffer ? buffer_index.at(buffer.get()) : int32_t(-1);
+        };
+        binio::write<int32_t>(stream, index_of(inst.concat_buffer()));
+        binio::write<int32_t>(stream, index_of(inst.concat_slice()));
+        binio::write<int32_t>(stream, int32_t(inst.concat_slice_index()));
+    }
+
+    static Instruction::shared read_operator(StreamReader &stream, const ComputingDevice &device,
+                                             const std::vector<ConcatBuffer::shared> &buffers) {
+        int32_t nargs = 0, nresults = 0;
+        uint8_t view = 0;
+        std::string description, op_name;
+        binio::read<int32_t>(stream, nargs);
+        binio::read<int32_t>(stream, nresults);
+        binio::read<uint8_t>(stream, view);
+        read_string(stream, description);
+        read_string(stream, op_name);
+
+        auto creator = OperatorCreator::Query(device.type(), op_name, false);
+        if (creator == nullptr) TS_LOG_ERROR << "Not supported operator " << op_name << eject;
+        auto op = creator();
+
+        uint32_t size_buffer = 0;
+        binio::read<uint32_t>(stream, size_buffer);
+        std::string name;
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            Tensor value;
+            read_string(stream, name);
+            value.externalize(stream);
+            op->set(name, value);
+        }
+        try {
+            op->init();
+        } catch (const Exception &e) {
+            TS_LOG_ERROR << "While initializing " << op_name << ":" << op->name() << " got Exception: " << e.what() << eject;
+        }
+
+        auto inst = std::make_shared<OperatorInstruction>(op, nargs, nresults, description);
+        inst->bind_creator(creator);
+        inst->set_view(view != 0);
+
+        int32_t buffer = -1, slice = -1, slice_index = -1;
+        binio::read<int32_t>(stream, buffer);
+        binio::read<int32_t>(stream, slice);
+        binio::read<int32_t>(stream, slice_index);
+        if (buffer >= 0) inst->bind_concat_buffer(buffers.at(size_t(buffer)));
+        if (slice >= 0) inst->bind_concat_slice(buffers.at(size_t(slice)), slice_index);
+        return inst;
+    }
+
+    static Instruction::shared stack_operation(int32_t code, int32_t arg0, int32_t arg1) {
+        using Code = instruction::StackOperation;
+        switch (code) {
+            case Code::PUSH: return instruction::Stack::push(arg0);
+            case Code::CLONE: return instruction::Stack::clone(arg0);
+            case Code::ERASE: return instruction::Stack::erase(arg0);
+            case Code::ERASE_RANGE: return instruction::Stack::erase(arg0, arg1);
+            case Code::RING_SHIFT_LEFT: return instruction::Stack::ring_shift_left();
+            case Code::SWAP: return instruction::Stack::swap(arg0, arg1);
+            default: break;
+        }
+        TS_LOG_ERROR << "Unknown stack operation code: " << code << eject;
+        return nullptr;
+    }
+
+    void Program::Save(StreamWriter &stream, const Program::shared &program) {
+        // 0. save header
+        Header header;
+        header.code = TS_PROGRAM_CODE_V1;
+        uint32_t alignment = TS_MODULE_ALIGNMENT;
+        std::memcpy(header.data.data(), &alignment, sizeof(alignment));
+        auto header_size = header.serialize(stream);
+
+        AlignedStreamWriter aligned_stream(stream, alignment, header_size);
+
+        // 1. save key
+        write_key(aligned_stream, program->m_device, program->m_options);
+        binio::write<uint8_t>(aligned_stream, uint8_t(program->m_plan_memory));
+        binio::write<uint8_t>(aligned_stream, uint8_t(program->m_register_form));
+
+        // 2. save inputs and outputs
+        binio::write<uint32_t>(aligned_stream, uint32_t(program->m_input_names.size()));
+        for (size_t i = 0; i < program->m_input_names.size(); ++i) {
+            write_string(aligned_stream, program->m_input_names[i]);
+            binio::write<int32_t>(aligned_stream, int32_t(program->m_input_dtypes[i]));
+        }
+        binio::write<uint32_t>(aligned_stream, uint32_t(program->m_output_names.size()));
+        for (size_t i = 0; i < program->m_output_names.size(); ++i) {
+            write_string(aligned_stream, program->m_output_names[i]);
+            binio::write<int32_t>(aligned_stream, int32_t(program->m_output_dtypes[i]));
+        }
+
+        // 3. save data segment
+        auto &data_segment = *program->m_data_segment;
+        binio::write<uint32_t>(aligned_stream, uint32_t(data_segment.size()));
+        for (size_t i = 0; i < data_segment.size(); ++i) {
+            auto &value = *data_segment.index(int(i));
+            write_string(aligned_stream, value.device().type().std());
+            binio::write<int32_t>(aligned_stream, int32_t(value.device().id()));
+            value.serialize(aligned_stream);
+        }
+
+        // 4. save concat buffers
+        std::vector<ConcatBuffer::shared> buffers;
+        std::unordered_map<ConcatBuffer *, int32_t> buffer_index;
+        auto index_buffer = [&](const ConcatBuffer::shared &buffer) {
+            if (buffer == nullptr || buffer_index.find(buffer.get()) != buffer_index.end()) return;
+            buffer_index.insert(std::make_pair(buffer.get(), int32_t(buffers.size())));
+            buffers.push_back(buffer);
+        };
+        for (auto &inst : program->m_program) {
+            auto op = dynamic_cast<OperatorInstruction *>(inst.get());
+            if (op == nullptr) continue;
+            index_buffer(op->concat_buffer());
+            index_buffer(op->concat_slice());
+        }
+        binio::write<uint32_t>(aligned_stream, uint32_t(buffers.size()));
+        for (auto &buffer : buffers) {
+            binio::write<int32_t>(aligned_stream, int32_t(buffer->dim()));
+        }
+
+        // 5. save instructions
+        binio::write<uint32_t>(aligned_stream, uint32_t(program->m_program.size()));
+        for (auto &inst : program->m_program) {
+            if (auto stack = dynamic_cast<instruction::StackOperation *>(inst.get())) {
+                binio::write<uint8_t>(aligned_stream, uint8_t(SavedInstruction::STACK));
+                binio::write<int32_t>(aligned_stream, int32_t(stack->code()));
+                binio::write<int32_t>(aligned_stream, int32_t(stack->arg0()));
+                binio::write<int32_t>(aligned_stream, int32_t(stack->arg1()));
+            } else if (auto pack = dynamic_cast<instruction::PackInstruction *>(inst.get())) {
+                binio::write<uint8_t>(aligned_stream, uint8_t(SavedInstruction::PACK));
+                binio::write<uint32_t>(aligned_stream, uint32_t(pack->size()));
+            } else if (auto field = dynamic_cast<instruction::FieldInstruction *>(inst.get())) {
+                binio::write<uint8_t>(aligned_stream, uint8_t(SavedInstruction::FIELD));
+                binio::write<int32_t>(aligned_stream, int32_t(field->index()));
+            } else if (auto data = dynamic_cast<DataSegmentInstruction *>(inst.get())) {
+                binio::write<uint8_t>(aligned_stream, uint8_t(SavedInstruction::DATA));
+                binio::write<int32_t>(aligned_stream, int32_t(data->data_index()));
+            } else if (auto op = dynamic_cast<OperatorInstruction *>(inst.get())) {
+                binio::write<uint8_t>(aligned_stream, uint8_t(SavedInstruction::OPERATOR));
+                write_operator(aligned_stream, *op, buffer_index);
+            } else {
+                TS_LOG_ERROR << "Can not save instruction: " << inst->str() << eject;
+            }
+        }
+    }
+
+    void Program::Save(const std::string &filename, const Program::shared &program) {
+        // data segment of program loaded from filename maps the file, so write aside and replace it
+        auto saving = filename + ".saving";
+        try {
+            FileStreamWriter stream(saving);
+            TS_CHECK(stream.is_open()) << "Can not access: " << saving << eject;
+            Save(stream, program);
+        } catch (...) {
+            std::remove(saving.c_str());
+            throw;
+        }
+        if (std::rename(saving.c_str(), filename.c_str()) != 0) {
+            std::remove(filename.c_str());
+            if (std::rename(saving.c_str(), filename.c_str()) != 0) {
+                std::remove(saving.c_str());
+                TS_LOG_ERROR << "Can not access: " << filename << eject;
+            }
+        }
+    }
+
+    Program::shared Program::Load(StreamReader &stream, const ComputingDevice &device, const std::string &options) {
+        // check workbench context
+        {
+            auto bench = ctx::of<Workbench>::get();
+            if (bench == nullptr) {
+                TS_LOG_ERROR << "Context<Workbench> need, but not bind." << eject;
+            }
+        }
+
+        size_t read_size = 0;
+        // 0. read header
+        Header header;
+        read_size += header.externalize(stream);
+        TS_CHECK(header.code == TS_PROGRAM_CODE_V1) << "Not a saved program of this version" << eject;
+        uint32_t alignment = 1;
+        std::memcpy(&alignment, header.data.data(), sizeof(alignment));
+
+        AlignedStreamReader aligned_stream(stream, alignment, read_size);
+
+        // 1. read key
+        std::string library_version, device_type, saved_options;
+        int32_t format_version = 0;
+        int32_t device_id = 0;
+        read_string(aligned_stream, library_version);
+        binio::read<int32_t>(aligned_stream, format_version);
+        TS_CHECK(library_version == TS_LIBRARY_VERSION && format_version == TS_PROGRAM_FORMAT_VERSION)
+            << "Program saved by library " << library_version << " in format " << format_version
+            << ", can not load by library " << TS_LIBRARY_VERSION << " in format " << TS_PROGRAM_FORMAT_VERSION << eject;
+        read_string(aligned_stream, device_type);
+        binio::read<int32_t>(aligned_stream, device_id);
+        read_string(aligned_stream, saved_options);
+        ComputingDevice saved_device(device_type, device_id);
+        TS_CHECK(saved_device == device) << "Program saved for " << saved_device << ", can not run on " << device << eject;
+        TS_CHECK(saved_options == normalize_options(options))
+            << "Program saved with options \"" << saved_options << "\", not \"" << normalize_options(options) << "\"" << eject;
+
+        Program::shared program(new Program(device));
+        program->m_options = options;
+        uint8_t flag = 0;
+        binio::read<uint8_t>(aligned_stream, flag);
+        program->m_plan_memory = flag != 0;
+        binio::read<uint8_t>(aligned_stream, flag);
+        program->m_register_form = flag != 0;
+
+        // 2. read inputs and outputs
+        uint32_t size_buffer = 0;
+        int32_t dtype = 0;
+        std::string name;
+        binio::read<uint32_t>(aligned_stream, size_buffer);
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            read_string(aligned_stream, name);
+            binio::read<int32_t>(aligned_stream, dtype);
+            program->m_map_input_slots.insert(std::make_pair(name, int(i)));
+            program->m_input_names.emplace_back(name);
+            program->m_input_dtypes.emplace_back(DTYPE(dtype));
+        }
+        program->m_input_filters.resize(size_buffer);
+        binio::read<uint32_t>(aligned_stream, size_buffer);
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            read_string(aligned_stream, name);
+            binio::read<int32_t>(aligned_stream, dtype);
+            program->m_map_output_slots.insert(std::make_pair(name, int(i)));
+            program->m_output_names.emplace_back(name);
+            program->m_output_dtypes.emplace_back(DTYPE(dtype));
+        }
+
+        // 3. read data segment
+        DeviceContext device_context(device);
+        ctx::bind<DeviceContext> bind_device_context(device_context);
+
+        binio::read<uint32_t>(aligned_stream, size_buffer);
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            std::string memory_type;
+            int32_t memory_id = 0;
+            read_string(aligned_stream, memory_type);
+            binio::read<int32_t>(aligned_stream, memory_id);
+            MemoryDevice memory_device(memory_type, memory_id);
+            Tensor value;
+            value.externalize(aligned_stream);
+
+            bool mapped = true;
+            for (auto &field : value.unpack()) {
+                if (!MappedStreamReader::Mapped(field.data())) mapped = false;
+            }
+            if (mapped && memory_device == value.device()) {
+                // keep view of mapped file, instead of private copy
+                program->m_data_segment->push(value);
+            } else {
+                program->m_data_segment->clone_push(value, memory_device);
+            }
+        }
+
+        // 4. read concat buffers
+        std::vector<ConcatBuffer::shared> buffers;
+        binio::read<uint32_t>(aligned_stream, size_buffer);
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            int32_t dim = 0;
+            binio::read<int32_t>(aligned_stream, dim);
+            buffers.emplace_back(std::make_shared<ConcatBuffer>(dim));
+        }
+
+        // 5. read instructions
+        binio::read<uint32_t>(aligned_stream, size_buffer);
+        for (uint32_t i = 0; i < size_buffer; ++i) {
+            uint8_t kind = 0;
+            binio::read<uint8_t>(aligned_stream, kind);
+            int32_t arg0 = 0, arg1 = 0, arg2 = 0;
+            uint32_t size = 0;
+            switch (SavedInstruction(kind)) {
+                case SavedInstruction::STACK:
+                    binio::read<int32_t>(aligned_stream, arg0);
+                    binio::read<int32_t>(aligned_stream, arg1);
+                    binio::read<int32_t>(aligned_stream, arg2);
+                    program->m_program.push_back(stack_operation(arg0, arg1, arg2));
+                    break;
+                case SavedInstruction::PACK:
+                    binio::read<uint32_t>(aligned_stream, size);
+                    program->m_program.push_back(std::make_shared<instruction::PackInstruction>(size_t(size)));
+                    break;
+                case SavedInstruction::FIELD:
+                    binio::read<int32_t>(aligned_stream, arg0);
+                    program->m_program.push_back(std::make_shared<instruction::FieldInstruction>(arg0));
+                    break;
+                case SavedInstruction::DATA:
+                    binio::read<int32_t>(aligned_stream, arg0);
+                    program->m_program.push_back(std::make_shared<DataSegmentInstruction>(arg0));
+                    break;
+                case SavedInstruction::OPERATOR:
+                    program->m_program.push_back(read_operator(aligned_stream, device, buffers));
+                    break;
+                default:
+                    TS_LOG_ERROR << "Unknown saved instruction: " << int(kind) << eject;
+            }
+        }
+
+        return program;
+    }
+
+    Program::shared Program::Load(const std::string &filename, const ComputingDevice &device, const std::string &options) {
+        MappedStreamReader stream(filename);
+        TS_CHECK(stream.is_open()) << "Can not access: " << filename << eject;
+        return Load(stream, device, options);
+    }
+}
@@ -0,0 +1,84 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/register_program.h"
+
+#include <climits>
+
+namespace ts {
+    RegisterProgram::shared RegisterProgram::Compile(const Dataflow::shared &dataflow) {
+        if (dataflow == nullptr) return nullptr;
+        auto &values = dataflow->values();
+        auto &nodes = dataflow->nodes();
+
+        // last step reading each value, INT_MAX if program output
+        std::vector<int> last_use(values.size(), -1);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            for (auto input : nodes[i].inputs) last_use[input] = int(i);
+        }
+        for (auto output : dataflow->outputs()) last_use[output] = INT_MAX;
+
+        auto program = std::make_shared<RegisterProgram>();
+        std::vector<int> value_register(values.size(), -1);
+        std::vector<int> free_registers;
+
+        auto operand_of = [&](int value_index) {
+            Operand operand;
+            auto &value = values[value_index];
+            switch (value.kind) {
+                case Dataflow::Value::ARGUMENT:
+                    operand.kind = Operand::ARGUMENT;
+                    operand.index = value.index;
+                    break;
+                case Dataflow::Value::DATA:
+                    operand.kind = Operand::DATA;
+                    operand.index = value.index;
+                    break;
+                case Dataflow::Value::RESULT:
+                    operand.kind = Operand::REGISTER;
+                    operand.index = value_register[value_index];
+                    break;
+            }
+            return operand;
+        };
+
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto &node = nodes[i];
+            Step step;
+            step.instruction = node.instruction;
+            auto op = dynamic_cast<OperatorInstruction *>(node.instruction.get());
+            // concat buffers need running by instruction
+            if (op != nullptr && !op->concat_buffer() && !op->concat_slice()) step.op = op->op().get();
+            for (auto input : node.inputs) {
+                step.inputs.push_back(operand_of(input));
+            }
+            for (auto input : node.inputs) {
+                auto reg = value_register[input];
+                if (reg < 0 || last_use[input] != int(i)) continue;
+                // same value may be read twice in one step
+                value_register[input] = -1;
+                step.release.push_back(reg);
+                free_registers.push_back(reg);
+            }
+            if (last_use[node.output] >= 0) {
+                int reg = 0;
+                if (free_registers.empty()) {
+                    reg = program->m_registers++;
+                } else {
+                    reg = free_registers.back();
+                    free_registers.pop_back();
+                }
+                value_register[node.output] = reg;
+                step.output = reg;
+            }
+            program->m_steps.push_back(step);
+        }
+
+        for (auto output : dataflow->outputs()) {
+            program->m_outputs.push_back(operand_of(output));
+        }
+
+        return program;
+    }
+}
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <memory/flow.h>
+#include "utils/cpu.h"
 
 #ifdef TS_USE_CBLAS
 #if TS_PLATFORM_OS_MAC || TS_PLATFORM_OS_IOS
@@ -34,6 +35,10 @@ namespace ts {
     RuntimeContext::RuntimeContext() {
         set_computing_thread_number(4);
     }
+    RuntimeContext::RuntimeContext(int computing_thread_number)
+            : m_computing_thread_number(computing_thread_number) {
+    }
+
     RuntimeContext::RuntimeContext(const MemoryDevice &device): self() {
         this->m_flow = HypeSyncMemoryController<FlowMemoryController>::Make(device, false);
         this->m_dynamic = DynamicSyncMemoryController::Make(device, false);
@@ -57,6 +62,8 @@ namespace ts {
         this->m_computing_thread_number = fixed_thread_number;
 
         this->m_thread_pool = std::make_shared<ThreadPool>(fixed_thread_number);
+        this->m_thread_pool->set_spin_wait_time(m_spin_wait_time);
+        if (!m_cpu_affinity.empty()) this->m_thread_pool->set_cpu_affinity(m_cpu_affinity);
 #ifdef TS_USE_CBLAS
 #ifdef TS_USING_OPENBLAS
         goto_set_num_threads(fixed_thread_number);
@@ -66,6 +73,7 @@ namespace ts {
     }
 
     int RuntimeContext::get_computing_thread_number() const {
+        if (m_leased_thread_pool) return m_leased_thread_number;
         return m_computing_thread_number;
     }
 
@@ -75,6 +83,14 @@ namespace ts {
         if (m_thread_pool) {
             doly.m_thread_pool = std::make_shared<ThreadPool>(this->m_thread_pool->size());
         }
+        doly.m_inter_op_thread_number = this->m_inter_op_thread_number;
+        if (m_inter_op_thread_pool) {
+            doly.m_inter_op_thread_pool = std::make_shared<ThreadPool>(this->m_inter_op_thread_pool->size());
+        }
+        doly.set_spin_wait_time(this->m_spin_wait_time);
+        doly.set_cpu_affinity(this->m_cpu_affinity);
+        doly.m_cpu_huge_page = this->m_cpu_huge_page;
+        doly.m_numa_node = this->m_numa_node;
         if (this->m_dynamic) {
             doly.m_dynamic = this->m_dynamic->clone();
         }
@@ -84,6 +100,19 @@ namespace ts {
         return std::move(doly);
     }
 
+    RuntimeContext::self RuntimeContext::share() const {
+        self shadow(this->m_computing_thread_number);
+        shadow.m_thread_pool = this->m_thread_pool;
+        shadow.m_inter_op_thread_number = this->m_inter_op_thread_number;
+        shadow.m_inter_op_thread_pool = this->m_inter_op_thread_pool;
+        shadow.m_spin_wait_time = this->m_spin_wait_time;
+        shadow.m_cpu_affinity = this->m_cpu_affinity;
+        shadow.m_caller_cpu_ids = this->m_caller_cpu_ids;
+        shadow.m_cpu_huge_page = this->m_cpu_huge_page;
+        shadow.m_numa_node = this->m_numa_node;
+        return std::move(shadow);
+    }
+
     RuntimeContext::RuntimeContext(RuntimeContext::self &&other) {
         this->operator=(std::move(other));
     }
@@ -91,15 +120,154 @@ namespace ts {
     RuntimeContext::self &RuntimeContext::operator=(RuntimeContext::self &&other) {
         std::swap(this->m_computing_thread_number, other.m_computing_thread_number);
         std::swap(this->m_thread_pool, other.m_thread_pool);
+        std::swap(this->m_inter_op_thread_number, other.m_inter_op_thread_number);
+        std::swap(this->m_inter_op_thread_pool, other.m_inter_op_thread_pool);
+        std::swap(this->m_spin_wait_time, other.m_spin_wait_time);
+        std::swap(this->m_cpu_affinity, other.m_cpu_affinity);
+        std::swap(this->m_caller_cpu_ids, other.m_caller_cpu_ids);
+        std::swap(this->m_cpu_huge_page, other.m_cpu_huge_page);
+        std::swap(this->m_numa_node, other.m_numa_node);
+        std::swap(this->m_leased_thread_number, other.m_leased_thread_number);
+        std::swap(this->m_leased_thread_pool, other.m_leased_thread_pool);
         std::swap(this->m_dynamic, other.m_dynamic);
         std::swap(this->m_flow, other.m_flow);
         return *this;
     }
 
     ThreadPool &RuntimeContext::thread_pool() {
+        if (m_leased_thread_pool) return *this->m_leased_thread_pool;
         return *this->m_thread_pool;
     }
 
+    void RuntimeContext::lease(int computing_thread_number, ThreadPool::shared thread_pool) {
+        this->m_leased_thread_number = std::max(computing_thread_number, 1);
+        this->m_leased_thread_pool = std::move(thread_pool);
+    }
+
+    void RuntimeContext::unlease() {
+        this->m_leased_thread_number = 0;
+        this->m_leased_thread_pool.reset();
+    }
+
+    int RuntimeContext::get_inter_op_thread_number() const {
+        return m_inter_op_thread_number;
+    }
+
+    void RuntimeContext::set_inter_op_thread_number(int inter_op_thread_number) {
+        int fixed_thread_number;
+        if (inter_op_thread_number < 0) {
+            fixed_thread_number = int(std::thread::hardware_concurrency());
+            if (fixed_thread_number <= 0) fixed_thread_number = 8;
+        } else if (inter_op_thread_number == 0) {
+            fixed_thread_number = 1;
+        } else {
+            fixed_thread_number = inter_op_thread_number;
+        }
+        this->m_inter_op_thread_number = fixed_thread_number;
+
+        if (fixed_thread_number > 1) {
+            this->m_inter_op_thread_pool = std::make_shared<ThreadPool>(fixed_thread_number);
+            this->m_inter_op_thread_pool->set_spin_wait_time(m_spin_wait_time);
+        } else {
+            this->m_inter_op_thread_pool.reset();
+        }
+    }
+
+    ThreadPool *RuntimeContext::inter_op_thread_pool() {
+        return this->m_inter_op_thread_pool.get();
+    }
+
+    int RuntimeContext::get_spin_wait_time() const {
+        return m_spin_wait_time;
+    }
+
+    void RuntimeContext::set_spin_wait_time(int microseconds) {
+        this->m_spin_wait_time = std::max(microseconds, 0);
+        if (m_thread_pool) m_thread_pool->set_spin_wait_time(m_spin_wait_time);
+        if (m_inter_op_thread_pool) m_inter_op_thread_pool->set_spin_wait_time(m_spin_wait_time);
+    }
+
+    void RuntimeContext::set_cpu_affinity(const std::vector<int> &cpu_ids) {
+        this->m_cpu_affinity = cpu_ids;
+        this->m_caller_cpu_ids.clear();
+        if (!cpu_ids.empty()) this->m_caller_cpu_ids.push_back(cpu_ids[0]);
+        if (m_thread_pool) m_thread_pool->set_cpu_affinity(cpu_ids);
+    }
+
+    const std::vector<int> &RuntimeContext::get_cpu_affinity() const {
+        return m_cpu_affinity;
+    }
+
+    void RuntimeContext::set_cpu_huge_page(bool enable) {
+        this->m_cpu_huge_page = enable;
+    }
+
+    bool RuntimeContext::get_cpu_huge_page() const {
+        return m_cpu_huge_page;
+    }
+
+    void RuntimeContext::set_numa_node(int node) {
+        this->m_numa_node = std::max(node, -1);
+    }
+
+    int RuntimeContext::get_numa_node() const {
+        return m_numa_node;
+    }
+
+    /**
+     * cpus OpenMP threads of calling thread pinned on
+     */
+    static thread_local std::vector<int> tls_bound_cpu_ids;
+    static thread_local int tls_bound_threads = 0;
+
+    /**
+     * cpus calling thread runs on, read once per thread, then tracked in pinning and restoring
+     */
+    static thread_local std::vector<int> tls_thread_cpu_ids;
+    static thread_local bool tls_thread_cpu_ids_known = false;
+
+    std::vector<int> RuntimeContext::bind_computing_threads() const {
+        if (m_cpu_affinity.empty() && tls_bound_cpu_ids.empty()) return {};
+        if (!tls_thread_cpu_ids_known) {
+            tls_thread_cpu_ids = CpuEnable::get_thread_cpus();
+            tls_thread_cpu_ids_known = true;
+        }
+        auto caller_cpu_ids = tls_thread_cpu_ids;
+        auto threads = get_computing_thread_number();
+        bool flag = true;
+        if (m_cpu_affinity == tls_bound_cpu_ids && threads == tls_bound_threads) {
+            // OpenMP threads already pinned, so is calling thread in nested run
+            if (caller_cpu_ids == m_caller_cpu_ids) return {};
+            flag = CpuEnable::bind_thread(m_caller_cpu_ids);
+        } else {
+            flag = CpuEnable::bind_computing_threads(m_cpu_affinity, threads);
+            tls_bound_cpu_ids = m_cpu_affinity;
+            tls_bound_threads = threads;
+        }
+        // not pinned on any single cpu if no affinity, read again after restored
+        tls_thread_cpu_ids = m_caller_cpu_ids;
+        tls_thread_cpu_ids_known = flag && !m_caller_cpu_ids.empty();
+        if (!flag) {
+            TS_LOG_ERROR << "Can not pin " << threads << " computing threads on " << m_cpu_affinity.size() << " cpus";
+        }
+        return caller_cpu_ids;
+    }
+
+    void RuntimeContext::unbind_computing_threads(const std::vector<int> &caller_cpu_ids) {
+        if (caller_cpu_ids.empty()) return;
+        tls_thread_cpu_ids_known = CpuEnable::bind_thread(caller_cpu_ids);
+        tls_thread_cpu_ids = caller_cpu_ids;
+    }
+
+    RuntimeContext::self RuntimeContext::branch(int computing_thread_number) const {
+        self worker(std::max(computing_thread_number, 1));
+        worker.m_flow = this->m_flow;
+        worker.m_dynamic = this->m_dynamic;
+        worker.m_cpu_huge_page = this->m_cpu_huge_page;
+        worker.m_numa_node = this->m_numa_node;
+        return std::move(worker);
+    }
+
     void RuntimeContext::bind_flow(SyncMemoryController::shared flow) {
         m_flow = std::move(flow);
     }
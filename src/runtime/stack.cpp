@@ -26,6 +26,20 @@ namespace ts {
         return Tensor(m_controller, dtype, shape, device);
     }
 
+    Tensor *Stack::push(DTYPE dtype, const Shape &shape, const MemoryDevice &device) {
+        // only the tensor pushed at the preset slot is the output of operator
+        if (m_preset && m_stack.size() == m_preset_slot) {
+            auto preset = m_preset;
+            m_preset.reset();
+            Tensor::Prototype proto(dtype, shape);
+            if (preset->device() == device &&
+                preset->size() == size_t(proto.count() * proto.type_bytes())) {
+                return this->push(Tensor(*preset, proto));
+            }
+        }
+        return this->push(this->make(dtype, shape, device));
+    }
+
     Tensor Stack::make(const TensorPrototype &proto) {
         Tensor packed;
         auto count = proto.fields_count();
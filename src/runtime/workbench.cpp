@@ -27,8 +27,27 @@
 
 #include "utils/ctxmgr_lite_support.h"
 #include "utils/cpu_info.h"
+#include "utils/cpu.h"
+#include "runtime/compute_pool.h"
+#include "kernels/cpu/memory_cpu.h"
+
+#include <condition_variable>
+#include <exception>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace ts {
+    /**
+     * @return placement of CPU memory allocated with runtime bound
+     */
+    static CpuMemoryPlacement cpu_memory_placement(const RuntimeContext &runtime) {
+        CpuMemoryPlacement placement;
+        placement.huge_page = runtime.get_cpu_huge_page();
+        placement.numa_node = runtime.get_numa_node();
+        return placement;
+    }
+
     class BindWorkbenchRuntime {
     public:
         using self = BindWorkbenchRuntime;
@@ -37,6 +56,8 @@ namespace ts {
             : bind_thread_pool(bench.runtime().thread_pool())
             // , bind_device_context(bench.device())
             , bind_runtime_context(bench.runtime())
+            , m_cpu_memory_placement(cpu_memory_placement(bench.runtime()))
+            , bind_cpu_memory_placement(m_cpu_memory_placement)
             , bind_work_bench(bench) {
             // bench.device().active();
             m_pre_device_context = DeviceContext::Switch(&bench.device());
@@ -61,11 +82,120 @@ namespace ts {
         // bind runtime context
         ctx::bind<RuntimeContext> bind_runtime_context;
 
+        // bind placement of CPU memory by runtime context
+        CpuMemoryPlacement m_cpu_memory_placement;
+        ctx::bind<CpuMemoryPlacement> bind_cpu_memory_placement;
+
+        // pre_device_context
+        DeviceContext *m_pre_device_context = nullptr;
+
+        // bind self
+        ctx::bind<Workbench> bind_work_bench;
+    };
+
+    /**
+     * lease cores from shared compute pool for one run, if enabled
+     */
+    class BindComputeLease {
+    public:
+        using self = BindComputeLease;
+
+        explicit BindComputeLease(RuntimeContext &runtime) {
+            // nested run in same thread uses cores already leased
+            if (tls_leased) return;
+            m_pool = ComputePool::Global();
+            if (m_pool == nullptr) return;
+            m_runtime = &runtime;
+            m_cores = m_pool->acquire(runtime.get_computing_thread_number());
+            runtime.lease(m_cores, m_pool->thread_pool());
+            tls_leased = true;
+        }
+
+        ~BindComputeLease() {
+            if (m_pool == nullptr) return;
+            tls_leased = false;
+            m_runtime->unlease();
+            m_pool->release(m_cores);
+        }
+
+        BindComputeLease(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+    private:
+        static thread_local bool tls_leased;
+
+        ComputePool::shared m_pool;
+        RuntimeContext *m_runtime = nullptr;
+        int m_cores = 0;
+    };
+
+    thread_local bool BindComputeLease::tls_leased = false;
+
+    /**
+     * pin computing threads for one run, calling thread restored after running
+     */
+    class BindComputingThreads {
+    public:
+        using self = BindComputingThreads;
+
+        explicit BindComputingThreads(const RuntimeContext &runtime)
+            : m_caller_cpu_ids(runtime.bind_computing_threads()) {}
+
+        ~BindComputingThreads() {
+            RuntimeContext::unbind_computing_threads(m_caller_cpu_ids);
+        }
+
+        BindComputingThreads(const self &) = delete;
+
+        self &operator=(const self &) = delete;
+
+    private:
+        std::vector<int> m_caller_cpu_ids;
+    };
+
+    class BindWorkbenchWorker {
+    public:
+        using self = BindWorkbenchWorker;
+
+        explicit BindWorkbenchWorker(Workbench &bench, RuntimeContext &runtime)
+            : bind_thread_pool(nullptr)
+            , bind_runtime_context(runtime)
+            , m_cpu_memory_placement(cpu_memory_placement(runtime))
+            , bind_cpu_memory_placement(m_cpu_memory_placement)
+            , bind_work_bench(bench)
+            , bind_computing_threads(runtime) {
+            m_pre_device_context = DeviceContext::Switch(&bench.device());
+
+            auto switch_controller = bench.switch_controller();
+            if(switch_controller->is_load_dll()){
+                switch_controller->bind_context();
+            }
+        }
+
+        ~BindWorkbenchWorker() {
+            DeviceContext::Switch(m_pre_device_context);
+        }
+
+    private:
+        // unbind inter-op thread pool, operators in worker run without intra-op tasks
+        ctx::bind<ThreadPool> bind_thread_pool;
+
+        // bind worker's runtime context
+        ctx::bind<RuntimeContext> bind_runtime_context;
+
+        // bind placement of worker's CPU memory
+        CpuMemoryPlacement m_cpu_memory_placement;
+        ctx::bind<CpuMemoryPlacement> bind_cpu_memory_placement;
+
         // pre_device_context
         DeviceContext *m_pre_device_context = nullptr;
 
         // bind self
         ctx::bind<Workbench> bind_work_bench;
+
+        // pin worker's computing threads
+        BindComputingThreads bind_computing_threads;
     };
 
     static std::string feature_log(const std::vector<CPUFeature> &features) {
@@ -110,14 +240,17 @@ namespace ts {
         auto &memory_device = this->m_device_context.memory_device;
 
         this->m_static_memory = DynamicSyncMemoryController::Make(memory_device, true);
-        // TODO: Make real flow memory controller
-        this->m_flow_memory = HypeSyncMemoryController<FlowMemoryController>::Make(memory_device, false);
+        auto flow_memory = HypeSyncMemoryController<PlannedMemoryController>::Make(memory_device, false);
+        this->m_flow_planner = flow_memory->controller(memory_device);
+        this->m_flow_memory = flow_memory;
         this->m_dynamic_memory = DynamicSyncMemoryController::Make(memory_device, false);
         this->m_stack = std::make_shared<Stack>(memory_device, this->m_flow_memory);
         // bind flow and dynamic memory, so you can use it to alloc memory in any where
         this->m_runtime_context.bind_flow(this->m_flow_memory);
         this->m_runtime_context.bind_dynamic(this->m_dynamic_memory);
 
+        this->m_async = std::make_shared<AsyncQueue>();
+
         this->m_switch_controller = std::make_shared<SwitchControll>();
         if(!check_cpu_features()){
             m_switch_controller->auto_switch(device);
@@ -135,6 +268,7 @@ namespace ts {
     }
 
     Workbench::~Workbench() {
+        this->release_async();
         this->m_desktop.reset();
         this->m_stack->clear();
         this->m_inputs.clear();
@@ -151,17 +285,223 @@ namespace ts {
     }
 
     void Workbench::run() {
+        run_inputs(m_inputs);
+    }
+
+    void Workbench::run_inputs(const std::vector<Tensor> &inputs) {
         if (m_desktop == nullptr) {
             TS_LOG_ERROR << "Can not run workbench with no program setup" << eject;
         }
 
         this->m_hooked_tensor.clear();
 
-        auto outputs = launch_offline(m_desktop, m_inputs);
+        BindComputeLease _bind_lease(m_runtime_context);
+
+        if (m_desktop->plan_memory() && m_runtime_context.inter_op_thread_pool() == nullptr) {
+            // release last outputs, so the planned arena can be reused
+            for (auto &output : m_outputs) output = Tensor();
+            m_outputs = launch_planned(m_desktop, inputs);
+            return;
+        }
+
+        auto outputs = launch_offline(m_desktop, inputs);
 
         m_outputs = outputs;
     }
 
+    /**
+     * threads running async requests of all workbenches
+     */
+    static ThreadPool &async_executor() {
+        static ThreadPool executor(std::max<size_t>(std::thread::hardware_concurrency(), 1));
+        return executor;
+    }
+
+    /**
+     * call back async request, exceptions thrown in callback are logged
+     */
+    static void async_call_back(const Workbench::async_callback &callback, Workbench &bench,
+                                std::exception_ptr exception) {
+        if (!callback) return;
+        try {
+            callback(bench, exception);
+        } catch (const Exception &e) {
+            TS_LOG_ERROR << "Async callback failed: " << e.what();
+        } catch (const std::exception &e) {
+            TS_LOG_ERROR << "Async callback failed: " << e.what();
+        }
+    }
+
+    /**
+     * owned by workbench and its draining task, so the task can finish after workbench freed in callback
+     */
+    class Workbench::AsyncQueue {
+    public:
+        using self = AsyncQueue;
+
+        struct Request {
+            std::function<void()> run;  ///< run and call back
+            async_callback callback;    ///< called with exception if workbench released before running
+        };
+
+        std::mutex mutex;
+        std::deque<Request> requests;
+        bool draining = false;      ///< draining task pushed in executor
+        std::thread::id drainer;    ///< thread running requests
+        ThreadPool::Group group;    ///< draining task of this queue
+
+        /**
+         * run requests until none waiting
+         */
+        void drain() {
+            while (true) {
+                Request request;
+                {
+                    std::unique_lock<std::mutex> _lock(mutex);
+                    if (requests.empty()) return;
+                    request = std::move(requests.front());
+                    requests.pop_front();
+                }
+                request.run();
+            }
+        }
+
+        /**
+         * @return requests waiting, which will never run
+         */
+        std::deque<Request> take() {
+            std::unique_lock<std::mutex> _lock(mutex);
+            std::deque<Request> waiting;
+            waiting.swap(requests);
+            return waiting;
+        }
+
+        bool in_drainer() {
+            std::unique_lock<std::mutex> _lock(mutex);
+            return draining && drainer == std::this_thread::get_id();
+        }
+    };
+
+    void Workbench::run_async(const std::vector<Tensor> &inputs, const async_callback &callback) {
+        if (m_desktop == nullptr) {
+            TS_LOG_ERROR << "Can not run workbench with no program setup" << eject;
+        }
+        if (inputs.size() != m_inputs.size()) {
+            TS_LOG_ERROR << "Input number must be " << m_inputs.size() << " vs. " << inputs.size() << " got." << eject;
+        }
+
+        AsyncQueue::Request request;
+        request.run = [this, inputs, callback]() {
+            std::exception_ptr exception;
+            try {
+                this->run_inputs(inputs);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            // workbench may be freed in callback, never touched after
+            async_call_back(callback, *this, exception);
+        };
+        request.callback = callback;
+
+        auto async = m_async;
+        std::unique_lock<std::mutex> _lock(async->mutex);
+        async->requests.push_back(std::move(request));
+        if (async->draining) return;
+        async->draining = true;
+        async_executor().run(async->group, [async](int) {
+            {
+                std::unique_lock<std::mutex> _lock(async->mutex);
+                async->drainer = std::this_thread::get_id();
+            }
+            while (true) {
+                async->drain();
+                std::unique_lock<std::mutex> _lock(async->mutex);
+                if (async->requests.empty()) {
+                    async->draining = false;
+                    async->drainer = std::thread::id();
+                    return;
+                }
+            }
+        });
+    }
+
+    void Workbench::run_async(const async_callback &callback) {
+        run_async(m_inputs, callback);
+    }
+
+    std::future<std::vector<Tensor>> Workbench::run_async(const std::vector<Tensor> &inputs) {
+        auto promise = std::make_shared<std::promise<std::vector<Tensor>>>();
+        auto future = promise->get_future();
+        run_async(inputs, [promise](Workbench &bench, std::exception_ptr exception) {
+            if (exception) {
+                promise->set_exception(exception);
+            } else {
+                promise->set_value(bench.m_outputs);
+            }
+        });
+        return future;
+    }
+
+    std::future<std::vector<Tensor>> Workbench::run_async() {
+        return run_async(m_inputs);
+    }
+
+    void Workbench::join_async() {
+        auto async = m_async;
+        if (async->in_drainer()) {
+            // called in callback, can not wait the running request itself
+            async->drain();
+            return;
+        }
+        // executor thread keeps running other tasks while waiting
+        async_executor().join(async->group);
+    }
+
+    void Workbench::release_async() {
+        auto async = m_async;
+        // waiting requests captured this workbench, fail them instead of running on workbench being released
+        auto waiting = async->take();
+        if (!async->in_drainer()) async_executor().join(async->group);
+        if (waiting.empty()) return;
+        auto exception = std::make_exception_ptr(Exception("Workbench released before async run"));
+        for (auto &request : waiting) {
+            async_call_back(request.callback, *this, exception);
+        }
+    }
+
+    static std::string memory_plan_signature(const std::vector<Tensor> &args) {
+        std::ostringstream oss;
+        for (auto &arg : args) {
+            oss << type_str(arg.dtype()) << to_string(arg.sizes()) << ";";
+        }
+        return oss.str();
+    }
+
+    std::vector<Tensor> Workbench::launch_planned(Program::shared program, const std::vector<Tensor> &args) {
+        auto signature = memory_plan_signature(args);
+        auto plan = program->memory_plan(signature);
+
+        if (plan) {
+            m_flow_planner->replay(plan);
+        } else {
+            m_flow_planner->record();
+        }
+        ts::need finish_plan(&PlannedMemoryController::finish, m_flow_planner.get());
+
+        auto outputs = launch_offline(program, args);
+
+        finish_plan.release();
+        auto built = m_flow_planner->finish();
+        if (built) {
+            program->memory_plan(signature, built);
+        } else if (m_flow_planner->missed()) {
+            // allocations changed, record again in next run
+            program->memory_plan(signature, nullptr);
+        }
+
+        return outputs;
+    }
+
     Workbench::shared Workbench::clone() const {
         Workbench::shared dolly(new Workbench(
                 this->m_device_context.computing_device));
@@ -178,6 +518,25 @@ namespace ts {
         return std::move(dolly);
     }
 
+    Workbench::shared Workbench::fork() const {
+        Workbench::shared dolly(new Workbench(
+                this->m_device_context.computing_device));
+
+        dolly->m_runtime_context = this->m_runtime_context.share();
+        dolly->m_runtime_context.bind_flow(dolly->m_flow_memory);
+        dolly->m_runtime_context.bind_dynamic(dolly->m_dynamic_memory);
+
+        BindWorkbenchRuntime _bind_runtime(*dolly);
+
+        dolly->m_inputs.resize(this->m_inputs.size());
+        dolly->m_outputs.resize(this->m_outputs.size());
+        if (this->m_desktop) {
+            dolly->m_desktop = this->m_desktop->clone();
+        }
+
+        return std::move(dolly);
+    }
+
     Workbench::shared Workbench::Load(const Module::shared &module, const ComputingDevice &device) {
         auto bench = std::make_shared<Workbench>(device);
         bench->setup(bench->compile(module));
@@ -435,6 +794,7 @@ namespace ts {
          * TODO: had to find way to avoid loop binding
          */
         BindWorkbenchRuntime _bind_runtime(*this);
+        BindComputingThreads _bind_computing_threads(m_runtime_context);
 
         /**
          * Save base, so now can do something
@@ -475,14 +835,16 @@ namespace ts {
         /**
          * Start run program
          */
-        while (true) {
-            auto &running_program = this->m_env.top();
-            auto &pointer = running_program.pointer;
-            auto &length = running_program.length;
-            if (pointer >= length) break;
-            auto &inst = running_program.program->instruction(pointer);
-            pointer++;
-            inst->run(*this);
+        if (!launch_dataflow(*program) && !launch_registers(*program)) {
+            while (true) {
+                auto &running_program = this->m_env.top();
+                auto &pointer = running_program.pointer;
+                auto &length = running_program.length;
+                if (pointer >= length) break;
+                auto &inst = running_program.program->instruction(pointer);
+                pointer++;
+                inst->run(*this);
+            }
         }
 
         /**
@@ -496,6 +858,243 @@ namespace ts {
         return int(this->m_stack->size());
     }
 
+    /**
+     * running state of dataflow, shared by dispatching thread and workers
+     */
+    class DataflowState {
+    public:
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::deque<int> ready;
+        std::vector<int> depends;
+        std::vector<int> uses;
+        std::vector<Tensor> values;
+        size_t running = 0;
+        size_t finished = 0;
+        std::exception_ptr exception;
+    };
+
+    bool Workbench::launch_dataflow(const Program &program) {
+        auto pool = m_runtime_context.inter_op_thread_pool();
+        if (pool == nullptr) return false;
+        // hook and profiler need running in order
+        if (ctx::get<Hook>() != nullptr || ctx::get<Profiler>() != nullptr) return false;
+        auto dataflow = program.dataflow();
+        if (dataflow == nullptr || dataflow->nodes().size() < 2) return false;
+
+        auto &memory_device = m_device_context.memory_device;
+        if (m_parallel_flow_memory == nullptr) {
+            m_parallel_flow_memory = HypeSyncMemoryController<LockedVatMemoryController>::Make(memory_device, true);
+        }
+
+        // split computing threads to workers
+        auto worker_number = pool->size();
+        auto worker_computing_thread_number =
+                std::max<int>(1, m_runtime_context.get_computing_thread_number() / int(worker_number));
+        std::vector<RuntimeContext> workers;
+        workers.reserve(worker_number);
+        // each worker pins its computing threads on own slice of cpus
+        auto &cpu_affinity = m_runtime_context.get_cpu_affinity();
+        for (size_t i = 0; i < worker_number; ++i) {
+            workers.emplace_back(m_runtime_context.branch(worker_computing_thread_number));
+            workers.back().bind_flow(m_parallel_flow_memory);
+            if (cpu_affinity.empty()) continue;
+            std::vector<int> worker_cpu_affinity(worker_computing_thread_number);
+            for (int j = 0; j < worker_computing_thread_number; ++j) {
+                worker_cpu_affinity[j] =
+                        cpu_affinity[(i * worker_computing_thread_number + j) % cpu_affinity.size()];
+            }
+            workers.back().set_cpu_affinity(worker_cpu_affinity);
+        }
+
+        auto &nodes = dataflow->nodes();
+        auto &values = dataflow->values();
+
+        DataflowState state;
+        state.values.resize(values.size());
+        state.uses.resize(values.size());
+        state.depends.resize(nodes.size());
+
+        auto &stack = *this->m_stack;
+        for (size_t i = 0; i < values.size(); ++i) {
+            auto &value = values[i];
+            state.uses[i] = value.uses;
+            switch (value.kind) {
+                default:
+                    break;
+                case Dataflow::Value::ARGUMENT:
+                    state.values[i] = *stack.index(value.index);
+                    break;
+                case Dataflow::Value::DATA:
+                    state.values[i] = program.data_segment(value.index);
+                    break;
+            }
+        }
+        stack.pop(stack.size());
+
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            state.depends[i] = nodes[i].depends;
+            if (state.depends[i] == 0) state.ready.push_back(int(i));
+        }
+
+        auto execute = [&](const Dataflow::Node &node) {
+            Stack local(memory_device, m_parallel_flow_memory);
+            for (auto input : node.inputs) {
+                local.push(state.values[input]);
+            }
+            node.instruction->run(local);
+            if (local.size() != 1) {
+                TS_LOG_ERROR << "Instruction " << node.instruction->str() << " expected 1 output, got "
+                             << local.size() << eject;
+            }
+            state.values[node.output] = local[0];
+        };
+
+        // signet < 0 means running on dispatching thread, which is already bound to this workbench
+        auto task = [&](int node_index, int signet) {
+            auto &node = nodes[node_index];
+            std::exception_ptr exception;
+            try {
+                if (signet < 0) {
+                    execute(node);
+                } else {
+                    BindWorkbenchWorker _bind_worker(*this, workers[signet]);
+                    execute(node);
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+
+            std::unique_lock<std::mutex> _lock(state.mutex);
+            // release results no more used
+            for (auto input : node.inputs) {
+                if (--state.uses[input] == 0 && values[input].kind == Dataflow::Value::RESULT) {
+                    state.values[input] = Tensor();
+                }
+            }
+            if (exception) {
+                if (!state.exception) state.exception = exception;
+            } else {
+                for (auto next : node.next) {
+                    if (--state.depends[next] == 0) state.ready.push_back(next);
+                }
+                ++state.finished;
+            }
+            --state.running;
+            state.cond.notify_all();
+        };
+
+        {
+            std::unique_lock<std::mutex> _lock(state.mutex);
+            while (true) {
+                state.cond.wait(_lock, [&]() {
+                    return state.exception || !state.ready.empty() || state.running == 0;
+                });
+                if (state.exception || state.ready.empty()) {
+                    state.cond.wait(_lock, [&]() { return state.running == 0; });
+                    break;
+                }
+                auto node_index = state.ready.front();
+                state.ready.pop_front();
+                ++state.running;
+                _lock.unlock();
+                if (nodes[node_index].view) {
+                    // views cost nothing, not worth a trip to pool
+                    task(node_index, -1);
+                } else {
+                    pool->run([&task, node_index](int signet) {
+                        task(node_index, signet);
+                    });
+                }
+                _lock.lock();
+            }
+        }
+        pool->join();
+
+        if (state.exception) std::rethrow_exception(state.exception);
+        if (state.finished != nodes.size()) {
+            TS_LOG_ERROR << "Dataflow stopped with " << state.finished << " of " << nodes.size()
+                         << " instructions finished" << eject;
+        }
+
+        for (auto output : dataflow->outputs()) {
+            stack.push(state.values[output]);
+        }
+
+        return true;
+    }
+
+    bool Workbench::launch_registers(const Program &program) {
+        if (!program.register_form()) return false;
+        // hook and profiler need running instruction by instruction
+        if (ctx::get<Hook>() != nullptr || ctx::get<Profiler>() != nullptr) return false;
+        auto registers = program.register_program();
+        if (registers == nullptr) return false;
+
+        if (m_register_stack == nullptr) {
+            m_register_stack = std::make_shared<Stack>(m_device_context.memory_device, m_flow_memory);
+        }
+        auto &local = *m_register_stack;
+        auto &stack = *this->m_stack;
+        auto &data_segment = program.data_segment();
+
+        m_registers.resize(size_t(registers->registers()));
+        ts::need clear_registers([this]() {
+            for (auto &reg : m_registers) reg = Tensor();
+            m_register_stack->clear();
+        });
+
+        auto operand = [&](const RegisterProgram::Operand &operand) -> const Tensor & {
+            switch (operand.kind) {
+                default:
+                case RegisterProgram::Operand::REGISTER:
+                    return m_registers[operand.index];
+                case RegisterProgram::Operand::ARGUMENT:
+                    return *stack.index(operand.index);
+                case RegisterProgram::Operand::DATA:
+                    return *data_segment.index(operand.index);
+            }
+        };
+
+        for (auto &step : registers->steps()) {
+            for (auto &input : step.inputs) {
+                local.push(operand(input));
+            }
+            for (auto reg : step.release) {
+                m_registers[reg] = Tensor();
+            }
+            if (step.op != nullptr) {
+                // same as OperatorInstruction::run on local stack, without hook, profiler or concat buffer
+                auto return_size = step.op->run(local);
+                if (return_size != 1) {
+                    TS_LOG_ERROR << "Operator " << step.op->name() << "<" << step.op->op() << "> expected "
+                                 << 1 << " outputs, got " << return_size << eject;
+                }
+            } else {
+                step.instruction->run(local);
+            }
+            if (local.size() < 1) {
+                TS_LOG_ERROR << "Instruction " << step.instruction->str() << " expected 1 output, got "
+                             << local.size() << eject;
+            }
+            if (step.output >= 0) {
+                m_registers[step.output] = *local.top();
+            }
+            local.clear();
+        }
+
+        std::vector<Tensor> outputs;
+        for (auto &output : registers->outputs()) {
+            outputs.push_back(operand(output));
+        }
+        stack.pop(stack.size());
+        for (auto &output : outputs) {
+            stack.push(output);
+        }
+
+        return true;
+    }
+
     void Workbench::setup(Program::shared program) {
         this->m_desktop = program;
         if (program == nullptr) {
@@ -643,11 +1242,30 @@ namespace ts {
             << ", \"thread\": " << m_runtime_context.get_computing_thread_number()
             << ", \"shared\": \"" << memory_size_string(shared_memory) << "\""
             << ", \"memory\": " << m_flow_memory->summary()
+            << ", \"statistics\": " << m_flow_memory->statistics()
             << "}";
         m_summary = oss.str();
         return m_summary;
     }
 
+    void Workbench::set_numa_node(int node, bool replicate) {
+        if (node < 0) {
+            m_runtime_context.set_cpu_affinity({});
+            m_runtime_context.set_numa_node(-1);
+            return;
+        }
+        auto cpu_ids = CpuEnable::get_numa_node_cpus(node);
+        if (cpu_ids.empty()) {
+            TS_LOG_ERROR << "Can not get cpus of NUMA node " << node << eject;
+        }
+        m_runtime_context.set_cpu_affinity(cpu_ids);
+        m_runtime_context.set_numa_node(node);
+        if (replicate && m_desktop) {
+            BindWorkbenchRuntime _bind_runtime(*this);
+            m_desktop = m_desktop->replicate();
+        }
+    }
+
     bool Workbench::set_cpu_power_mode(CpuEnable::CpuPowerMode cpu_mode){
         bool flag = CpuEnable::set_power_mode(cpu_mode);
         if (flag) {
@@ -0,0 +1,120 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include "runtime/workbench_pool.h"
+
+#include "utils/log.h"
+
+#include <chrono>
+#include <algorithm>
+
+namespace ts {
+    /**
+     * idle workbenches, kept alive by checked out workbenches after pool destroyed
+     */
+    class WorkbenchShelf {
+    public:
+        using self = WorkbenchShelf;
+        using shared = std::shared_ptr<self>;
+
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::vector<Workbench::shared> idle;
+        WorkbenchPool::Statistics statistics;
+
+        static Workbench::shared Lend(const shared &shelf, Workbench::shared bench) {
+            auto raw = bench.get();
+            return Workbench::shared(raw, [shelf, bench](Workbench *) mutable {
+                bench->clear();
+                std::unique_lock<std::mutex> _lock(shelf->mutex);
+                shelf->idle.push_back(std::move(bench));
+                shelf->cond.notify_one();
+            });
+        }
+    };
+
+    class WorkbenchPool::Implement {
+    public:
+        using self = Implement;
+
+        WorkbenchShelf::shared shelf = std::make_shared<WorkbenchShelf>();
+        int size = 0;
+    };
+
+    WorkbenchPool::WorkbenchPool(Workbench::shared prototype, int size)
+        : self(std::move(prototype), size, {}, false) {
+    }
+
+    WorkbenchPool::WorkbenchPool(Workbench::shared prototype, int size, const std::vector<int> &nodes, bool replicate) {
+        if (prototype == nullptr) {
+            TS_LOG_ERROR << "Can not build pool from null workbench" << eject;
+        }
+        size = std::max(size, 1);
+
+        // first workbench on each node, with own thread pools
+        std::vector<Workbench::shared> leaders;
+        auto leader_count = std::min(nodes.size(), size_t(size));
+        for (size_t i = 0; i < leader_count; ++i) {
+            // prototype is still used by caller, never placed or put in pool
+            auto leader = prototype->clone();
+            leader->set_numa_node(nodes[i], replicate);
+            leaders.push_back(leader);
+        }
+
+        auto &idle = m_impl->shelf->idle;
+        idle.reserve(size);
+        for (int i = 0; i < size; ++i) {
+            if (leaders.empty()) {
+                // prototype is still used by caller, never put it in pool
+                idle.push_back(prototype->fork());
+                continue;
+            }
+            auto &leader = leaders[size_t(i) % leaders.size()];
+            idle.push_back(size_t(i) < leaders.size() ? leader : leader->fork());
+        }
+        m_impl->size = size;
+        m_impl->shelf->statistics.size = size;
+    }
+
+    WorkbenchPool::~WorkbenchPool() = default;
+
+    Workbench::shared WorkbenchPool::checkout() {
+        auto &shelf = m_impl->shelf;
+        std::unique_lock<std::mutex> _lock(shelf->mutex);
+        ++shelf->statistics.checkouts;
+        if (shelf->idle.empty()) {
+            ++shelf->statistics.waits;
+            auto start = std::chrono::steady_clock::now();
+            while (shelf->idle.empty()) shelf->cond.wait(_lock);
+            auto wait_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+            shelf->statistics.wait_time += uint64_t(wait_time.count());
+        }
+        auto bench = std::move(shelf->idle.back());
+        shelf->idle.pop_back();
+        return WorkbenchShelf::Lend(shelf, std::move(bench));
+    }
+
+    Workbench::shared WorkbenchPool::try_checkout() {
+        auto &shelf = m_impl->shelf;
+        std::unique_lock<std::mutex> _lock(shelf->mutex);
+        if (shelf->idle.empty()) return nullptr;
+        ++shelf->statistics.checkouts;
+        auto bench = std::move(shelf->idle.back());
+        shelf->idle.pop_back();
+        return WorkbenchShelf::Lend(shelf, std::move(bench));
+    }
+
+    int WorkbenchPool::size() const {
+        return m_impl->size;
+    }
+
+    WorkbenchPool::Statistics WorkbenchPool::statistics() const {
+        auto &shelf = m_impl->shelf;
+        std::unique_lock<std::mutex> _lock(shelf->mutex);
+        auto statistics = shelf->statistics;
+        statistics.idle = int(shelf->idle.size());
+        return statistics;
+    }
+}
@@ -4,14 +4,20 @@
 #include "utils/cpu.h"
 #include "utils/log.h"
 #include <fstream>
+#include <sstream>
 #include <regex>
 #include <vector>
 #include <memory.h>
 
+#include <algorithm>
+#include <map>
+
 #if TS_PLATFORM_OS_ANDROID
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <stdint.h>
+#elif TS_PLATFORM_OS_LINUX
+#include <sched.h>
 #endif
 
 #ifdef TS_USE_OPENMP
@@ -267,4 +273,220 @@ namespace ts{
     {
         return CpuPowerMode(g_power_mode);
     }
+
+    static int read_cpu_topology(int cpu_id, const std::string &name, int default_value) {
+        std::ifstream fread("/sys/devices/system/cpu/cpu" + std::to_string(cpu_id) + "/topology/" + name);
+        if (!fread.is_open()) return default_value;
+        int value = default_value;
+        fread >> value;
+        return fread.fail() ? default_value : value;
+    }
+
+#if TS_PLATFORM_OS_LINUX && !TS_PLATFORM_OS_ANDROID
+    static cpu_set_t static_get_process_cpu_set() {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+            for (int i = 0; i < g_cpu_num && i < CPU_SETSIZE; ++i) CPU_SET(i, &mask);
+        }
+        return mask;
+    }
+
+    // cpus process can run on, before any thread pinned
+    static cpu_set_t g_process_cpu_set = static_get_process_cpu_set();
+#endif
+
+    static std::vector<int> get_process_cpu_ids() {
+        std::vector<int> cpu_ids;
+#if TS_PLATFORM_OS_LINUX && !TS_PLATFORM_OS_ANDROID
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &g_process_cpu_set)) cpu_ids.push_back(i);
+        }
+#elif TS_PLATFORM_OS_ANDROID
+        for (int i = 0; i < g_cpu_num; ++i) cpu_ids.push_back(i);
+#endif
+        return cpu_ids;
+    }
+
+    class CpuTopology {
+    public:
+        int id = 0;
+        int package = 0;
+        int core = 0;
+        int core_rank = 0;  ///< index of core in package
+        int smt_rank = 0;   ///< index of cpu in core
+    };
+
+    std::vector<int> CpuEnable::get_cpu_affinity(CpuAffinityPolicy policy) {
+        std::vector<CpuTopology> cpus;
+        for (auto id : get_process_cpu_ids()) {
+            CpuTopology cpu;
+            cpu.id = id;
+            cpu.package = read_cpu_topology(id, "physical_package_id", 0);
+            cpu.core = read_cpu_topology(id, "core_id", id);
+            cpus.push_back(cpu);
+        }
+
+        // compact order
+        std::sort(cpus.begin(), cpus.end(), [](const CpuTopology &lhs, const CpuTopology &rhs) {
+            if (lhs.package != rhs.package) return lhs.package < rhs.package;
+            if (lhs.core != rhs.core) return lhs.core < rhs.core;
+            return lhs.id < rhs.id;
+        });
+        std::map<int, int> package_cores;
+        for (size_t i = 0; i < cpus.size(); ++i) {
+            auto &cpu = cpus[i];
+            if (i > 0 && cpus[i - 1].package == cpu.package && cpus[i - 1].core == cpu.core) {
+                cpu.core_rank = cpus[i - 1].core_rank;
+                cpu.smt_rank = cpus[i - 1].smt_rank + 1;
+            } else {
+                cpu.core_rank = package_cores[cpu.package]++;
+                cpu.smt_rank = 0;
+            }
+        }
+
+        switch (policy) {
+            default:
+            case COMPACT:
+                break;
+            case SCATTER:
+                std::stable_sort(cpus.begin(), cpus.end(), [](const CpuTopology &lhs, const CpuTopology &rhs) {
+                    if (lhs.smt_rank != rhs.smt_rank) return lhs.smt_rank < rhs.smt_rank;
+                    if (lhs.core_rank != rhs.core_rank) return lhs.core_rank < rhs.core_rank;
+                    return lhs.package < rhs.package;
+                });
+                break;
+            case PHYSICAL:
+                cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [](const CpuTopology &cpu) {
+                    return cpu.smt_rank > 0;
+                }), cpus.end());
+                break;
+        }
+
+        std::vector<int> cpu_ids;
+        for (auto &cpu : cpus) cpu_ids.push_back(cpu.id);
+        return cpu_ids;
+    }
+
+    /**
+     * parse cpu list like "0-3,8,10-11"
+     */
+    static std::vector<int> read_id_list(const std::string &path) {
+        std::vector<int> ids;
+        std::ifstream fread(path);
+        if (!fread.is_open()) return ids;
+        std::string list;
+        std::getline(fread, list);
+        std::istringstream iss(list);
+        std::string range;
+        while (std::getline(iss, range, ',')) {
+            if (range.empty()) continue;
+            auto dash = range.find('-');
+            try {
+                auto first = std::stoi(range.substr(0, dash));
+                auto last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int id = first; id <= last; ++id) ids.push_back(id);
+            } catch (const std::exception &) {
+                return {};
+            }
+        }
+        return ids;
+    }
+
+    std::vector<int> CpuEnable::get_numa_nodes() {
+#if TS_PLATFORM_OS_LINUX
+        return read_id_list("/sys/devices/system/node/online");
+#else
+        return {};
+#endif
+    }
+
+    std::vector<int> CpuEnable::get_numa_node_cpus(int node) {
+#if TS_PLATFORM_OS_LINUX
+        auto node_cpus = read_id_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::vector<int> cpu_ids;
+        for (auto id : get_cpu_affinity(COMPACT)) {
+            if (std::find(node_cpus.begin(), node_cpus.end(), id) != node_cpus.end()) cpu_ids.push_back(id);
+        }
+        return cpu_ids;
+#else
+        (void)(node);
+        return {};
+#endif
+    }
+
+    bool CpuEnable::bind_thread(int cpu_id) {
+#if TS_PLATFORM_OS_ANDROID
+        if (cpu_id < 0) {
+            return set_sched_affinity(get_process_cpu_ids());
+        }
+        return set_sched_affinity({cpu_id});
+#elif TS_PLATFORM_OS_LINUX
+        cpu_set_t mask;
+        if (cpu_id < 0) {
+            mask = g_process_cpu_set;
+        } else {
+            if (cpu_id >= CPU_SETSIZE) return false;
+            CPU_ZERO(&mask);
+            CPU_SET(cpu_id, &mask);
+        }
+        return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+        (void)(cpu_id);
+        return false;
+#endif
+    }
+
+    bool CpuEnable::bind_thread(const std::vector<int> &cpu_ids) {
+#if TS_PLATFORM_OS_ANDROID
+        return set_sched_affinity(cpu_ids.empty() ? get_process_cpu_ids() : cpu_ids);
+#elif TS_PLATFORM_OS_LINUX
+        if (cpu_ids.empty()) return bind_thread(-1);
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (auto cpu_id : cpu_ids) {
+            if (cpu_id < 0 || cpu_id >= CPU_SETSIZE) return false;
+            CPU_SET(cpu_id, &mask);
+        }
+        return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+        (void)(cpu_ids);
+        return false;
+#endif
+    }
+
+    std::vector<int> CpuEnable::get_thread_cpus() {
+        std::vector<int> cpu_ids;
+#if TS_PLATFORM_OS_ANDROID
+        // no query of thread affinity, cpus process can run on instead
+        cpu_ids = get_process_cpu_ids();
+#elif TS_PLATFORM_OS_LINUX
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (sched_getaffinity(0, sizeof(mask), &mask) != 0) return cpu_ids;
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &mask)) cpu_ids.push_back(i);
+        }
+#endif
+        return cpu_ids;
+    }
+
+    bool CpuEnable::bind_computing_threads(const std::vector<int> &cpu_ids, int threads) {
+        auto cpu_of = [&](int i) { return cpu_ids.empty() ? -1 : cpu_ids[i % cpu_ids.size()]; };
+        bool flag = bind_thread(cpu_of(0));
+#ifdef TS_USE_OPENMP
+        if (threads > 1) {
+            std::vector<char> flags(size_t(threads), 1);
+            #pragma omp parallel num_threads(threads)
+            {
+                auto i = omp_get_thread_num();
+                if (i > 0 && i < threads) flags[i] = char(bind_thread(cpu_of(i)));
+            }
+            for (auto each : flags) flag = flag && each;
+        }
+#else
+        (void)(threads);
+#endif
+        return flag;
+    }
 }
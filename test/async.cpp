@@ -0,0 +1,171 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = sigmoid(x + 1)
+ */
+static Module::shared simple_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto one = bubble::data("one", tensor::from<float>(1.0f));
+    auto a = bubble::op("a", name::layer::add(), {x, one});
+    auto y = bubble::op("y", name::layer::sigmoid(), {a});
+    return Module::Load(g, {y});
+}
+
+static Tensor input(int seed) {
+    Tensor x(FLOAT32, {1, 3, 8, 8});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+static bool expected(const Tensor &x, const Tensor &y) {
+    if (x.sizes() != y.sizes()) return false;
+    for (int i = 0; i < x.count(); ++i) {
+        auto want = 1.0f / (1.0f + std::exp(-(x.data<float>()[i] + 1.0f)));
+        if (std::fabs(want - y.data<float>()[i]) > 1e-5f) return false;
+    }
+    return true;
+}
+
+static Workbench::shared setup_bench(Module::shared module) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(bench->compile(module));
+    return bench;
+}
+
+void test_prepared_inputs(Module::shared module) {
+    auto bench = setup_bench(module);
+    std::vector<std::future<std::vector<Tensor>>> futures;
+    std::vector<Tensor> inputs;
+    for (int i = 0; i < 16; ++i) {
+        // inputs of next run set while last one running
+        inputs.push_back(input(i));
+        bench->input(0, inputs.back());
+        futures.push_back(bench->run_async());
+    }
+    bool same = true;
+    for (int i = 0; i < 16; ++i) {
+        auto outputs = futures[i].get();
+        if (outputs.size() != 1 || !expected(inputs[i], outputs[0])) same = false;
+    }
+    TS_LOG_CHECKING(same);
+
+    // inputs given by argument, set inputs untouched
+    auto x = input(100);
+    auto outputs = bench->run_async({x}).get();
+    TS_LOG_CHECKING(expected(x, outputs[0]));
+    TS_LOG_CHECKING(bench->input(0).data() == inputs.back().data());
+
+    bool thrown = false;
+    try {
+        bench->run_async(std::vector<Tensor>{x, x});
+    } catch (const Exception &) {
+        thrown = true;
+    }
+    TS_LOG_CHECKING(thrown);
+}
+
+void test_failed_run(Module::shared module) {
+    auto bench = setup_bench(module);
+    auto future = bench->run_async({Tensor()});
+    bool thrown = false;
+    try {
+        future.get();
+    } catch (const Exception &) {
+        thrown = true;
+    }
+    TS_LOG_CHECKING(thrown);
+    // next run is not affected
+    auto x = input(7);
+    TS_LOG_CHECKING(expected(x, bench->run_async({x}).get()[0]));
+}
+
+void test_join_in_callback(Module::shared module) {
+    auto bench = setup_bench(module);
+    std::atomic<int> finished(0);
+    for (int i = 0; i < 8; ++i) {
+        bench->run_async({input(i)}, [&finished](Workbench &bench, std::exception_ptr) {
+            bench.join_async();
+            ++finished;
+        });
+    }
+    bench->join_async();
+    TS_LOG_CHECKING(finished.load() == 8);
+}
+
+void test_free_in_callback(Module::shared module) {
+    auto bench = setup_bench(module);
+    std::atomic<int> finished(0);
+    std::atomic<int> failed(0);
+    std::atomic<bool> freed(false);
+    std::atomic<bool> queued(false);
+    Workbench::shared holder = bench;
+    bench.reset();
+    for (int i = 0; i < 8; ++i) {
+        auto x = input(i);
+        holder->run_async({x}, [&, i, x](Workbench &bench, std::exception_ptr exception) {
+            // waiting runs are failed in releasing workbench, never run on it
+            if (exception) {
+                if (!freed.load()) ++failed;
+                return;
+            }
+            if (expected(x, bench.output(0))) ++finished;
+            // drop last reference in first callback
+            if (i == 0) {
+                while (!queued.load()) std::this_thread::yield();
+                holder.reset();
+                freed = true;
+            }
+        });
+    }
+    queued = true;
+    for (int i = 0; i < 1000 && !freed.load(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    TS_LOG_CHECKING(freed.load());
+    TS_LOG_CHECKING(finished.load() == 1);
+    TS_LOG_CHECKING(failed.load() == 7);
+}
+
+void test_release_waiting(Module::shared module) {
+    auto bench = setup_bench(module);
+    std::atomic<int> called(0);
+    for (int i = 0; i < 8; ++i) {
+        bench->run_async({input(i)}, [&](Workbench &, std::exception_ptr) { ++called; });
+    }
+    // running one finished, waiting ones failed, all called back before released
+    bench.reset();
+    TS_LOG_CHECKING(called.load() == 8);
+}
+
+int main() {
+    auto module = simple_module();
+
+    test_prepared_inputs(module);
+    test_failed_run(module);
+    test_join_in_callback(module);
+    test_free_in_callback(module);
+    test_release_waiting(module);
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static const std::string cache = "autotune_test.cache";
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale;
+    return x;
+}
+
+/**
+ * y = conv2d(x, w), 32 channels 3x3 kernel without padding, so winograd applies, x is declared as [1, 32, 16, 16]
+ */
+static Module::shared conv_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x", {1, 32, 16, 16});
+    auto w = bubble::data("w", values({32, 32, 3, 3}, 1, 0.1f));
+    auto y = bubble::op("y", name::layer::conv2d(), {x, w});
+    y.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 0, 0, 0, 0}));
+    y.bubble().set(name::format, tensor::from(name::NCHW));
+    y.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    y.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    return Module::Load(g, {y});
+}
+
+static int count_op(const Program &program, const std::string &op) {
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "conv2d(in=2, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static Tensor run(Workbench &bench, Program::shared program) {
+    bench.setup(program);
+    bench.input(0, values({1, 32, 16, 16}, 2, 2.0f));
+    bench.run();
+    return bench.output(0);
+}
+
+static float max_diff(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return INFINITY;
+    float diff = 0;
+    for (int i = 0; i < lhs.count(); ++i) {
+        diff = std::max(diff, std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]));
+    }
+    return diff;
+}
+
+/**
+ * write copy of cache, with every algorithm replaced
+ * @return path of new cache
+ */
+static std::string force(const std::string &algorithm) {
+    auto path = "autotune_test_" + algorithm + ".cache";
+    std::ifstream in(cache);
+    std::ofstream out(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        auto tab = line.rfind('\t');
+        if (tab == std::string::npos) continue;
+        out << line.substr(0, tab) << '\t' << algorithm << std::endl;
+    }
+    return path;
+}
+
+static int count_lines(const std::string &path) {
+    std::ifstream in(path);
+    std::string line;
+    int count = 0;
+    while (std::getline(in, line)) ++count;
+    return count;
+}
+
+/**
+ * @return true if program compiled with cache uses expected operator, and has same output as original
+ */
+static bool check(const std::string &title, const std::string &path, const std::string &op, const Tensor &expected) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto program = bench->compile(conv_module(), "--autotune --autotune-cache=" + path);
+    if (count_op(*program, op) != 1) {
+        TS_LOG_INFO << title << ": " << op << " not used";
+        return false;
+    }
+    auto diff = max_diff(run(*bench, program), expected);
+    TS_LOG_INFO << title << ": max diff " << diff;
+    return diff < 1e-3f;
+}
+
+int main() {
+    std::remove(cache.c_str());
+
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto expected = run(*bench, bench->compile(conv_module(), ""));
+
+    // measured, then chosen one saved
+    auto tuned = bench->compile(conv_module(), "--autotune --autotune-cache=" + cache);
+    TS_LOG_CHECKING(count_lines(cache) == 1);
+    TS_LOG_CHECKING(max_diff(run(*bench, tuned), expected) < 1e-3f);
+
+    // read from cache, not measured again
+    bench->compile(conv_module(), "--autotune --autotune-cache=" + cache);
+    TS_LOG_CHECKING(count_lines(cache) == 1);
+
+    // each algorithm gives same output as original
+    TS_LOG_CHECKING(check("gemm", force("gemm"), name::layer::conv2d(), expected));
+    TS_LOG_CHECKING(check("f23", force(name::winograd_f23), name::layer::conv2d_winograd(), expected));
+    TS_LOG_CHECKING(check("f63", force(name::winograd_f63), name::layer::conv2d_winograd(), expected));
+
+    // cache path is required
+    bool thrown = false;
+    try {
+        bench->compile(conv_module(), "--autotune");
+    } catch (const Exception &) {
+        thrown = true;
+    }
+    TS_LOG_CHECKING(thrown);
+
+    for (auto algorithm : {std::string("gemm"), name::winograd_f23, name::winograd_f63}) {
+        std::remove(("autotune_test_" + algorithm + ".cache").c_str());
+    }
+    std::remove(cache.c_str());
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f, float bias = 0.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale + bias;
+    return x;
+}
+
+static Node data(const std::string &name, const Tensor &value) {
+    return bubble::data(name, value);
+}
+
+static void set_conv_params(Node &node, bool padding = true) {
+    if (padding) {
+        node.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+    }
+    node.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    node.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    node.bubble().set(name::format, tensor::from(name::NCHW));
+}
+
+static Node batch_norm(const std::string &name, const Node &x, int channels, int dim, float epsilon) {
+    auto mean = data(name + "_mean", values({channels}, 1, 0.2f));
+    auto variance = data(name + "_variance", values({channels}, 2, 0.5f, 0.5f));
+    auto node = bubble::op(name, name::layer::batch_norm(), {x, mean, variance});
+    node.bubble().set(name::dim, tensor::from<int32_t>(dim));
+    if (epsilon > 0) node.bubble().set(name::epsilon, tensor::from<float>(epsilon));
+    return node;
+}
+
+static Node fused_batch_norm(const std::string &name, const Node &x, int channels, int dim, float epsilon) {
+    auto mean = data(name + "_mean", values({channels}, 3, 0.2f));
+    auto variance = data(name + "_variance", values({channels}, 4, 0.01f, 0.01f));
+    auto scale = data(name + "_scale", values({channels}, 5, 1.0f, 1.0f));
+    auto bias = data(name + "_bias", values({channels}, 6, 0.5f));
+    auto node = bubble::op(name, name::layer::fused_batch_norm(), {x, mean, variance, scale, bias});
+    node.bubble().set(name::dim, tensor::from<int32_t>(dim));
+    if (epsilon > 0) node.bubble().set(name::epsilon, tensor::from<float>(epsilon));
+    return node;
+}
+
+static Node batch_scale(const std::string &name, const Node &x, int channels, int dim) {
+    auto scale = data(name + "_scale", values({channels}, 7, 1.0f, 1.0f));
+    auto bias = data(name + "_bias", values({channels}, 8, 0.5f));
+    auto node = bubble::op(name, name::layer::batch_scale(), {x, scale, bias});
+    node.bubble().set(name::dim, tensor::from<int32_t>(dim));
+    return node;
+}
+
+/**
+ * build module of y = tail(linear(x)), linear built by head
+ * @param unfolded if true, linear is also output, so tail can not be folded into it
+ */
+template <typename Head, typename Tail>
+static Module::shared build(Head head, Tail tail, bool unfolded) {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto linear = head(x);
+    auto y = tail(linear);
+    if (unfolded) {
+        auto side = bubble::op("side", name::layer::relu(), {linear});
+        return Module::Load(g, {y, side});
+    }
+    return Module::Load(g, {y});
+}
+
+static int count_op(const Program &program, const std::string &op) {
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "conv2d(in=2, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static float max_diff(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return INFINITY;
+    float diff = 0;
+    for (int i = 0; i < lhs.count(); ++i) {
+        diff = std::max(diff, std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]));
+    }
+    return diff;
+}
+
+/**
+ * @return true if folded and unfolded modules have same output, and folded one has no op in tail
+ */
+template <typename Head, typename Tail>
+static bool check(const std::string &title, Head head, Tail tail, const std::vector<std::string> &tail_ops,
+                  const Tensor &x) {
+    auto folded = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto folded_program = folded->compile(build(head, tail, false));
+    folded->setup(folded_program);
+    auto unfolded = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto unfolded_program = unfolded->compile(build(head, tail, true));
+    unfolded->setup(unfolded_program);
+
+    bool succeed = true;
+    for (auto &op : tail_ops) {
+        if (count_op(*folded_program, op) != 0) {
+            TS_LOG_INFO << title << ": " << op << " not folded";
+            succeed = false;
+        }
+        if (count_op(*unfolded_program, op) == 0) {
+            TS_LOG_INFO << title << ": " << op << " folded in reference";
+            succeed = false;
+        }
+    }
+
+    folded->input(0, x);
+    folded->run();
+    unfolded->input(0, x);
+    unfolded->run();
+    auto diff = max_diff(folded->output(0), unfolded->output(0));
+    TS_LOG_INFO << title << ": max diff " << diff;
+    return succeed && diff < 1e-4f;
+}
+
+int main() {
+    auto nchw = values({2, 4, 8, 8}, 0);
+
+    auto conv = [](const Node &x) {
+        auto w = data("w", values({6, 4, 3, 3}, 9, 0.5f));
+        auto node = bubble::op("conv", name::layer::conv2d(), {x, w});
+        set_conv_params(node);
+        return node;
+    };
+    TS_LOG_CHECKING(check("conv2d + batch_norm", conv, [](const Node &x) {
+        return batch_norm("bn", x, 6, 1, 0);
+    }, {name::layer::batch_norm()}, nchw));
+    TS_LOG_CHECKING(check("conv2d + batch_norm(epsilon=1e-2)", conv, [](const Node &x) {
+        return batch_norm("bn", x, 6, 1, 1e-2f);
+    }, {name::layer::batch_norm()}, nchw));
+    TS_LOG_CHECKING(check("conv2d + fused_batch_norm(epsilon=1e-3) + batch_scale", conv, [](const Node &x) {
+        return batch_scale("scale", fused_batch_norm("bn", x, 6, 1, 1e-3f), 6, 1);
+    }, {name::layer::fused_batch_norm(), name::layer::batch_scale()}, nchw));
+
+    auto conv_v2 = [](const Node &x) {
+        auto padding = data("padding", tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+        auto w = data("w", values({6, 4, 3, 3}, 11, 0.5f));
+        auto node = bubble::op("conv", name::layer::conv2d_v2(), {x, padding, w});
+        set_conv_params(node, false);
+        return node;
+    };
+    TS_LOG_CHECKING(check("conv2d_v2 + fused_batch_norm(epsilon=1e-2)", conv_v2, [](const Node &x) {
+        return fused_batch_norm("bn", x, 6, 1, 1e-2f);
+    }, {name::layer::fused_batch_norm()}, nchw));
+
+    auto depthwise = [](const Node &x) {
+        auto w = data("w", values({1, 4, 3, 3}, 12, 0.5f));
+        auto node = bubble::op("conv", name::layer::depthwise_conv2d(), {x, w});
+        set_conv_params(node);
+        return node;
+    };
+    TS_LOG_CHECKING(check("depthwise_conv2d + batch_norm(epsilon=1e-3)", depthwise, [](const Node &x) {
+        return batch_norm("bn", x, 4, 1, 1e-3f);
+    }, {name::layer::batch_norm()}, nchw));
+
+    auto inner_prod = [](const Node &x) {
+        auto w = data("w", values({64, 5}, 13, 0.5f));
+        return bubble::op("fc", name::layer::inner_prod(), {x, w});
+    };
+    TS_LOG_CHECKING(check("inner_prod + batch_norm", inner_prod, [](const Node &x) {
+        return batch_norm("bn", x, 5, 1, 0);
+    }, {name::layer::batch_norm()}, values({3, 64}, 0)));
+
+    return 0;
+}
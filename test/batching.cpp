@@ -0,0 +1,168 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/batching_workbench.h>
+
+#include <utils/log.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = sigmoid(x + 1), batched along dim 0
+ */
+static Module::shared elementwise_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto one = bubble::data("one", tensor::from<float>(1.0f));
+    auto a = bubble::op("a", name::layer::add(), {x, one});
+    auto y = bubble::op("y", name::layer::sigmoid(), {a});
+    return Module::Load(g, {y});
+}
+
+/**
+ * y = transpose(x, {1, 0, 2, 3}), dim 0 of output is not batch
+ */
+static Module::shared transpose_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto y = bubble::op("y", name::layer::transpose(), {x});
+    y.bubble().set(name::permute, tensor::from(std::vector<int32_t>{1, 0, 2, 3}));
+    return Module::Load(g, {y});
+}
+
+static Tensor input(int batch, int channels, int seed) {
+    Tensor x(FLOAT32, {batch, channels, 4, 4});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+static bool elementwise_expected(const Tensor &x, const Tensor &y) {
+    if (x.sizes() != y.sizes()) return false;
+    for (int i = 0; i < x.count(); ++i) {
+        auto want = 1.0f / (1.0f + std::exp(-(x.data<float>()[i] + 1.0f)));
+        if (std::fabs(want - y.data<float>()[i]) > 1e-5f) return false;
+    }
+    return true;
+}
+
+static bool transpose_expected(const Tensor &x, const Tensor &y) {
+    auto n = x.size(0), c = x.size(1), hw = x.size(2) * x.size(3);
+    if (y.sizes() != Shape({c, n, x.size(2), x.size(3)})) return false;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < c; ++j) {
+            for (int k = 0; k < hw; ++k) {
+                if (x.data<float>()[(i * c + j) * hw + k] != y.data<float>()[(j * n + i) * hw + k]) return false;
+            }
+        }
+    }
+    return true;
+}
+
+static Workbench::shared setup_bench(Module::shared module) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(bench->compile(module));
+    return bench;
+}
+
+/**
+ * run requests in concurrent threads
+ * @return if all outputs expected
+ */
+template <typename Expected>
+static bool run_concurrently(BatchingWorkbench &batching, const std::vector<Tensor> &inputs, Expected expected) {
+    std::atomic<bool> succeed(true);
+    std::vector<std::thread> threads;
+    for (auto &x : inputs) {
+        threads.emplace_back([&, x]() {
+            try {
+                auto outputs = batching.run({x});
+                if (outputs.size() != 1 || !expected(x, outputs[0])) succeed = false;
+            } catch (...) {
+                succeed = false;
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    return succeed.load();
+}
+
+void test_batched() {
+    auto bench = setup_bench(elementwise_module());
+    BatchingWorkbench batching(bench, 4, 500 * 1000);
+
+    // first request run alone, showing outputs follow batch
+    auto x = input(1, 3, 0);
+    TS_LOG_CHECKING(elementwise_expected(x, batching.run({x})[0]));
+    TS_LOG_CHECKING(bench->input(0).size(0) == 1);
+
+    // 4 requests of batch 1, run in one batch
+    std::vector<Tensor> inputs;
+    for (int i = 0; i < 4; ++i) inputs.push_back(input(1, 3, i + 1));
+    TS_LOG_CHECKING(run_concurrently(batching, inputs, elementwise_expected));
+    TS_LOG_CHECKING(bench->input(0).size(0) == 4);
+
+    // requests of different batch, each gets its own slice
+    inputs = {input(2, 3, 10), input(1, 3, 11), input(1, 3, 12)};
+    TS_LOG_CHECKING(run_concurrently(batching, inputs, elementwise_expected));
+    TS_LOG_CHECKING(bench->input(0).size(0) == 4);
+
+    // inputs with different shape are not batched together
+    inputs = {input(1, 3, 20), input(1, 5, 21)};
+    TS_LOG_CHECKING(run_concurrently(batching, inputs, elementwise_expected));
+}
+
+void test_not_batched_outputs() {
+    auto bench = setup_bench(transpose_module());
+    BatchingWorkbench batching(bench, 3, 200 * 1000);
+
+    // dim 0 of batched output would be 3 too, but it's channels
+    std::vector<Tensor> inputs;
+    for (int i = 0; i < 3; ++i) inputs.push_back(input(1, 3, i));
+    TS_LOG_CHECKING(run_concurrently(batching, inputs, transpose_expected));
+    TS_LOG_CHECKING(run_concurrently(batching, inputs, transpose_expected));
+    TS_LOG_CHECKING(bench->input(0).size(0) == 1);
+}
+
+void test_timeout_since_enqueue() {
+    auto bench = setup_bench(elementwise_module());
+    const int timeout = 200;   // milliseconds
+    BatchingWorkbench batching(bench, 4, timeout * 1000);
+    auto x = input(1, 3, 0);
+    batching.run({x});
+
+    using clock = std::chrono::steady_clock;
+    // first request waits whole timeout
+    std::thread first([&]() { batching.run({input(1, 3, 1)}); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout / 2));
+    // second one can not batch with first, picked after first run but waits no more than timeout since enqueued
+    auto start = clock::now();
+    batching.run({input(1, 5, 2)});
+    auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start).count();
+    first.join();
+    TS_LOG_INFO << "Waited " << waited << "ms with timeout " << timeout << "ms";
+    TS_LOG_CHECKING(waited < timeout * 13 / 10);
+}
+
+int main() {
+    test_batched();
+    test_not_batched_outputs();
+    test_timeout_since_enqueue();
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include "runtime/compute_pool.h"
+
+#include "utils/log.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+void test_fair_share() {
+    ComputePool pool(4);
+    TS_LOG_CHECKING(pool.budget() == 4);
+
+    // alone, lease is bounded by budget and by wanted cores
+    auto all = pool.acquire(8);
+    TS_LOG_CHECKING(all == 4);
+    pool.release(all);
+    auto few = pool.acquire(1);
+    TS_LOG_CHECKING(few == 1);
+    pool.release(few);
+
+    // second run gets half of budget, even if first one left more free
+    auto first = pool.acquire(1);
+    auto second = pool.acquire(8);
+    TS_LOG_CHECKING(first == 1);
+    TS_LOG_CHECKING(second == 2);
+    pool.release(second);
+    pool.release(first);
+
+    // budget fixed to at least 1
+    ComputePool tiny(0);
+    TS_LOG_CHECKING(tiny.budget() == 1);
+    TS_LOG_CHECKING(tiny.acquire(4) == 1);
+    tiny.release(1);
+}
+
+void test_blocking() {
+    ComputePool pool(2);
+    auto held = pool.acquire(2);
+    std::atomic<int> leased(0);
+    std::thread waiter([&]() {
+        auto cores = pool.acquire(2);
+        leased = cores;
+        pool.release(cores);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // no free core, waiter blocked
+    TS_LOG_CHECKING(leased.load() == 0);
+    pool.release(held);
+    waiter.join();
+    TS_LOG_CHECKING(leased.load() >= 1);
+}
+
+void test_budget_bound() {
+    ComputePool pool(3);
+    std::atomic<int> in_use(0);
+    std::atomic<int> peak(0);
+    std::atomic<bool> in_range(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 200; ++i) {
+                auto wanted = 1 + (t + i) % 3;
+                auto cores = pool.acquire(wanted);
+                if (cores < 1 || cores > wanted) in_range = false;
+                auto now = in_use.fetch_add(cores) + cores;
+                auto last = peak.load();
+                while (now > last && !peak.compare_exchange_weak(last, now)) {}
+                std::this_thread::yield();
+                in_use.fetch_sub(cores);
+                pool.release(cores);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    TS_LOG_CHECKING(in_range.load());
+    TS_LOG_CHECKING(peak.load() <= 3);
+    // all cores given back
+    TS_LOG_CHECKING(pool.acquire(3) == 3);
+}
+
+void test_setup() {
+    ComputePool::Setup(2);
+    auto pool = ComputePool::Global();
+    TS_LOG_CHECKING(pool != nullptr && pool->budget() == 2);
+    ComputePool::Setup(0);
+    TS_LOG_CHECKING(ComputePool::Global() == nullptr);
+    // leased pool lives until released
+    TS_LOG_CHECKING(pool->acquire(2) == 2);
+    pool->release(2);
+}
+
+int main() {
+    test_fair_share();
+    test_blocking();
+    test_budget_bound();
+    test_setup();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <board/hook.h>
+#include <utils/cpu.h>
+
+#include <utils/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = sigmoid(x)
+ */
+static Module::shared simple_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto y = bubble::op("y", name::layer::sigmoid(), {x});
+    return Module::Load(g, {y});
+}
+
+static std::vector<int> sorted(std::vector<int> ids) {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+static bool unique(const std::vector<int> &ids) {
+    return std::set<int>(ids.begin(), ids.end()).size() == ids.size();
+}
+
+static bool subset(const std::vector<int> &ids, const std::vector<int> &of) {
+    std::set<int> all(of.begin(), of.end());
+    for (auto id : ids) {
+        if (all.find(id) == all.end()) return false;
+    }
+    return true;
+}
+
+/**
+ * @return true if output is right, calling thread pinned on first cpu in running, and restored after
+ */
+static bool check_run(Workbench &bench, const std::vector<int> &caller_cpu_ids) {
+    auto &affinity = bench.runtime().get_cpu_affinity();
+    Tensor x(FLOAT32, {1, 3, 4, 4});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float(i % 7) - 3.0f;
+    bool pinned = true;
+    Hook hook;
+    hook.before_run([&](const Hook::StructBeforeRun &) {
+        if (CpuEnable::get_thread_cpus() != std::vector<int>({affinity[0]})) pinned = false;
+    });
+    ctx::bind<Hook> _bind_hook(hook);
+    bench.input(0, x);
+    bench.run();
+    auto y = bench.output(0);
+    for (int i = 0; i < x.count(); ++i) {
+        if (std::fabs(y.data<float>()[i] - 1.0f / (1.0f + std::exp(-data[i]))) > 1e-5f) return false;
+    }
+    return pinned && CpuEnable::get_thread_cpus() == caller_cpu_ids;
+}
+
+int main() {
+    auto process = CpuEnable::get_thread_cpus();
+    if (process.empty()) {
+        TS_LOG_INFO << "Cpu affinity not supported, skipped";
+        return 0;
+    }
+
+    auto compact = CpuEnable::get_cpu_affinity(CpuEnable::COMPACT);
+    auto scatter = CpuEnable::get_cpu_affinity(CpuEnable::SCATTER);
+    auto physical = CpuEnable::get_cpu_affinity(CpuEnable::PHYSICAL);
+
+    // compact and scatter order all cpus, physical takes one cpu of each core
+    TS_LOG_CHECKING(sorted(compact) == process);
+    TS_LOG_CHECKING(sorted(scatter) == process);
+    TS_LOG_CHECKING(!physical.empty() && unique(physical) && subset(physical, process));
+    // first cpus of scatter are on distinct physical cores
+    TS_LOG_CHECKING(sorted(std::vector<int>(scatter.begin(), scatter.begin() + physical.size())) == sorted(physical));
+
+    for (auto &affinity : {compact, scatter, physical}) {
+        auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+        bench->runtime().set_computing_thread_number(2);
+        bench->runtime().set_cpu_affinity(affinity);
+        bench->setup(bench->compile(simple_module(), ""));
+        bool all_right = true;
+        for (int i = 0; i < 3; ++i) {
+            if (!check_run(*bench, process)) all_right = false;
+        }
+        TS_LOG_CHECKING(all_right);
+    }
+
+    // not pinned without affinity
+    {
+        auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+        bench->setup(bench->compile(simple_module(), ""));
+        Tensor x(FLOAT32, {1, 3, 4, 4});
+        bench->input(0, x);
+        bench->run();
+        TS_LOG_CHECKING(CpuEnable::get_thread_cpus() == process);
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Node conv(const std::string &name, const Node &x, int out_channels, int in_channels, float bias) {
+    std::vector<float> weights(size_t(out_channels * in_channels * 9));
+    for (size_t i = 0; i < weights.size(); ++i) weights[i] = float(int(i % 5) - 2) * 0.1f + bias;
+    auto w = bubble::data(name + "_w", tensor::build(FLOAT32, {out_channels, in_channels, 3, 3}, weights));
+    auto node = bubble::op(name, name::layer::conv2d(), {x, w});
+    node.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+    node.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    node.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    node.bubble().set(name::format, tensor::from("NCHW"));
+    return node;
+}
+
+/**
+ * x -> conv -> relu ------> add -> concat
+ *           -> sigmoid -> mul ----^
+ *           -> conv ---------^
+ */
+static Module::shared branching_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto stem = conv("stem", x, 8, 4, 0.0f);
+    auto a = bubble::op("a", name::layer::relu(), {stem});
+    auto b = bubble::op("b", name::layer::sigmoid(), {stem});
+    auto c = conv("c", stem, 8, 8, 0.05f);
+    auto d = bubble::op("d", name::layer::mul(), {b, c});
+    auto e = bubble::op("e", name::layer::add(), {a, d});
+    auto f = bubble::op("f", name::layer::concat(), {e, d, a});
+    f.bubble().set(name::dim, tensor::from(int32_t(1)));
+    return Module::Load(g, {f, b});
+}
+
+static Tensor input(int seed) {
+    Tensor x(FLOAT32, {2, 4, 16, 16});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 7 + seed) % 13) / 13.0f - 0.5f;
+    return x;
+}
+
+static float max_diff(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return INFINITY;
+    float diff = 0;
+    for (int i = 0; i < lhs.count(); ++i) {
+        diff = std::max(diff, std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]));
+    }
+    return diff;
+}
+
+int main() {
+    auto module = branching_module();
+
+    auto serial = std::make_shared<Workbench>(ComputingDevice(CPU));
+    serial->setup(serial->compile(module));
+
+    auto concurrent = std::make_shared<Workbench>(ComputingDevice(CPU));
+    concurrent->runtime().set_inter_op_thread_number(4);
+    concurrent->setup(concurrent->compile(module));
+
+    bool same = true;
+    for (int i = 0; i < 20; ++i) {
+        auto x = input(i);
+        serial->input(0, x);
+        serial->run();
+        concurrent->input(0, x);
+        concurrent->run();
+        for (int j = 0; j < 2; ++j) {
+            if (max_diff(serial->output(j), concurrent->output(j)) > 1e-5f) same = false;
+        }
+    }
+    TS_LOG_CHECKING(same);
+
+    // cloned workbench has own inter-op pool and local stacks
+    auto dolly = concurrent->clone();
+    auto x = input(100);
+    serial->input(0, x);
+    serial->run();
+    dolly->input(0, x);
+    dolly->run();
+    TS_LOG_CHECKING(max_diff(serial->output(0), dolly->output(0)) < 1e-5f);
+    TS_LOG_CHECKING(max_diff(serial->output(1), dolly->output(1)) < 1e-5f);
+
+    return 0;
+}
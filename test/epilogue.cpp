@@ -0,0 +1,187 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <functional>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * output channels, 8 rows block of packed gemm and 3 rows left
+ */
+static const int channels = 11;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f, float bias = 0.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale + bias;
+    return x;
+}
+
+static void set_conv_params(Node &node) {
+    node.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+    node.bubble().set(name::format, tensor::from(name::NCHW));
+}
+
+static Node conv2d(const Node &x) {
+    auto w = bubble::data("w", values({channels, 4, 3, 3}, 1, 0.5f));
+    auto node = bubble::op("conv", name::layer::conv2d(), {x, w});
+    set_conv_params(node);
+    node.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    node.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    return node;
+}
+
+static std::function<Node(const Node &)> conv2d_winograd(const std::string &mode) {
+    return [mode](const Node &x) {
+        auto w = bubble::data("w", values({channels, 4, 3, 3}, 1, 0.5f));
+        auto node = bubble::op("conv", name::layer::conv2d_winograd(), {x, w});
+        set_conv_params(node);
+        node.bubble().set(name::winograd_mode, tensor::from(mode));
+        return node;
+    };
+}
+
+static Node inner_prod(const Node &x) {
+    auto w = bubble::data("w", values({64, channels}, 2, 0.5f));
+    return bubble::op("fc", name::layer::inner_prod(), {x, w});
+}
+
+static Node add_bias(const Node &x) {
+    auto bias = bubble::data("bias", values({channels}, 3));
+    auto node = bubble::op("add_bias", name::layer::add_bias(), {x, bias});
+    node.bubble().set(name::dim, tensor::from<int32_t>(1));
+    return node;
+}
+
+static Node relu(const Node &x) {
+    return bubble::op("act", name::layer::relu(), {x});
+}
+
+static Node relu_max(const Node &x) {
+    auto node = bubble::op("act", name::layer::relu_max(), {x});
+    node.bubble().set(name::max, tensor::from<float>(0.3f));
+    return node;
+}
+
+static Node leaky_relu(const Node &x) {
+    auto node = bubble::op("act", name::layer::leaky_relu(), {x});
+    node.bubble().set(name::scale, tensor::from<float>(0.1f));
+    return node;
+}
+
+static Node prelu(const Node &x) {
+    auto slope = bubble::data("slope", values({channels}, 4, 0.5f, 0.25f));
+    auto node = bubble::op("act", name::layer::prelu(), {x, slope});
+    node.bubble().set(name::dim, tensor::from<int32_t>(1));
+    return node;
+}
+
+/**
+ * build module of y = act(add_bias(linear(x)))
+ * @param unfused if true, linear is also used by others, so nothing can be fused into it
+ */
+template <typename Linear, typename Activation>
+static Module::shared build(Linear linear, Activation activation, bool unfused) {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto y = linear(x);
+    auto z = activation(add_bias(y));
+    if (unfused) {
+        auto side = bubble::op("side", name::layer::sigmoid(), {y});
+        return Module::Load(g, {z, side});
+    }
+    return Module::Load(g, {z});
+}
+
+static int count_op(const Program &program, const std::string &op) {
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "relu(in=1, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static float max_diff(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return INFINITY;
+    float diff = 0;
+    for (int i = 0; i < lhs.count(); ++i) {
+        diff = std::max(diff, std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]));
+    }
+    return diff;
+}
+
+/**
+ * @return true if fused and unfused modules have same output, and fused one has no add_bias or activation
+ */
+template <typename Linear, typename Activation>
+static bool check(const std::string &title, Linear linear, Activation activation, const std::string &activation_op,
+                  const Tensor &x, const std::string &options) {
+    auto fused = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto fused_program = fused->compile(build(linear, activation, false), options);
+    fused->setup(fused_program);
+    auto unfused = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto unfused_program = unfused->compile(build(linear, activation, true), options);
+    unfused->setup(unfused_program);
+
+    bool succeed = true;
+    for (auto &op : {name::layer::add_bias(), activation_op}) {
+        if (count_op(*fused_program, op) != 0) {
+            TS_LOG_INFO << title << ": " << op << " not fused";
+            succeed = false;
+        }
+        if (count_op(*unfused_program, op) == 0) {
+            TS_LOG_INFO << title << ": " << op << " fused in reference";
+            succeed = false;
+        }
+    }
+
+    fused->input(0, x);
+    fused->run();
+    unfused->input(0, x);
+    unfused->run();
+    auto diff = max_diff(fused->output(0), unfused->output(0));
+    TS_LOG_INFO << title << ": max diff " << diff;
+    return succeed && diff < 1e-4f;
+}
+
+template <typename Linear>
+static void check_activations(const std::string &title, Linear linear, const Tensor &x,
+                              const std::string &options = "") {
+    TS_LOG_CHECKING(check(title + " + relu", linear, relu, name::layer::relu(), x, options));
+    TS_LOG_CHECKING(check(title + " + relu_max", linear, relu_max, name::layer::relu_max(), x, options));
+    TS_LOG_CHECKING(check(title + " + leaky_relu", linear, leaky_relu, name::layer::leaky_relu(), x, options));
+    TS_LOG_CHECKING(check(title + " + prelu", linear, prelu, name::layer::prelu(), x, options));
+}
+
+int main() {
+    auto image = values({2, 4, 10, 10}, 0);
+    auto matrix = values({10, 64}, 0);
+
+    // conv2d_core with kernel packed at compile time, and packed in gemm
+    check_activations("conv2d", conv2d, image);
+    check_activations("conv2d(--no-pack)", conv2d, image, "--no-pack");
+    check_activations("conv2d_winograd(f23)", conv2d_winograd(name::winograd_f23), image);
+    check_activations("conv2d_winograd(f63)", conv2d_winograd(name::winograd_f63), image);
+    // 10 rows, 8 rows block of packed gemm and 2 rows left
+    check_activations("inner_prod", inner_prod, matrix);
+    check_activations("inner_prod(--no-pack)", inner_prod, matrix, "--no-pack");
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = sigmoid(_reshape_v2(x, concat(gather(_shape(x), [0]), [-1]))), flatten x to [N, -1]
+ */
+static Module::shared flatten_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto s = bubble::op("s", name::layer::shape(), {x});
+    auto n = bubble::op("n", name::layer::gather(), {s, bubble::data("i", tensor::from(std::vector<int32_t>{0}))});
+    n.bubble().set(name::axis, tensor::from<int32_t>(0));
+    auto c = bubble::op("c", name::layer::concat(), {n, bubble::data("rest", tensor::from(std::vector<int32_t>{-1}))});
+    c.bubble().set(name::dim, tensor::from<int32_t>(0));
+    auto r = bubble::op("r", name::layer::reshape_v2(), {x, c});
+    auto y = bubble::op("y", name::layer::sigmoid(), {r});
+    return Module::Load(g, {y});
+}
+
+static int count_op(const Program &program, const std::string &op) {
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "_reshape(in=1, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static Tensor run(Workbench &bench, Program::shared program) {
+    Tensor x(FLOAT32, {2, 3, 4, 4});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5) % 11) / 11.0f - 0.5f;
+    bench.setup(program);
+    bench.input(0, x);
+    bench.run();
+    return bench.output(0);
+}
+
+/**
+ * @return if compile throws Exception
+ */
+static bool compile_throws(Workbench &bench, const std::string &options) {
+    try {
+        bench.compile(flatten_module(), options);
+    } catch (const Exception &) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto folded = bench->compile(flatten_module(), "--fold-shape --input-shape=x:2,3,4,4");
+    auto dynamic = bench->compile(flatten_module(), "");
+
+    TS_LOG_CHECKING(count_op(*dynamic, name::layer::shape()) == 1);
+    TS_LOG_CHECKING(count_op(*dynamic, name::layer::reshape_v2()) == 1);
+    TS_LOG_CHECKING(count_op(*folded, name::layer::shape()) == 0);
+    TS_LOG_CHECKING(count_op(*folded, name::layer::gather()) == 0);
+    TS_LOG_CHECKING(count_op(*folded, name::layer::concat()) == 0);
+    TS_LOG_CHECKING(count_op(*folded, name::layer::reshape_v2()) == 0);
+    TS_LOG_CHECKING(count_op(*folded, name::layer::reshape()) == 1);
+
+    auto lhs = run(*bench, folded);
+    auto rhs = run(*bench, dynamic);
+    bool same = lhs.sizes() == rhs.sizes() && lhs.sizes() == Shape({2, 48});
+    for (int i = 0; same && i < lhs.count(); ++i) {
+        if (lhs.data<float>()[i] != rhs.data<float>()[i]) same = false;
+    }
+    TS_LOG_CHECKING(same);
+
+    // each dim must be non-negative integer
+    TS_LOG_CHECKING(compile_throws(*bench, "--fold-shape --input-shape=x:2,-3,4,4"));
+    TS_LOG_CHECKING(compile_throws(*bench, "--fold-shape --input-shape=x:2,3a,4,4"));
+    TS_LOG_CHECKING(compile_throws(*bench, "--fold-shape --input-shape=x:2,,4,4"));
+    TS_LOG_CHECKING(compile_throws(*bench, "--fold-shape --input-shape=x:99999999999"));
+    TS_LOG_CHECKING(compile_throws(*bench, "--fold-shape --input-shape=x"));
+
+    return 0;
+}
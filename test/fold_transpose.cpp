@@ -0,0 +1,143 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <functional>
+#include <unordered_set>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static const std::vector<int32_t> to_nhwc = {0, 2, 3, 1};
+static const std::vector<int32_t> to_nchw = {0, 3, 1, 2};
+
+static Tensor values(const Shape &shape, int seed) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+static Node transpose(const std::string &name, const Node &x, const std::vector<int32_t> &permute) {
+    auto node = bubble::op(name, name::layer::transpose(), {x});
+    node.bubble().set(name::permute, tensor::from(permute));
+    return node;
+}
+
+/**
+ * @param shaped if x is declared with shape [2, 3, 4, 5]
+ */
+static Module::shared build(std::function<Node(const Node &)> body, bool shaped) {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = shaped ? bubble::param("x", {2, 3, 4, 5}) : bubble::param("x");
+    return Module::Load(g, {body(x)});
+}
+
+static void collect(const Node &node, std::unordered_set<Node> &nodes) {
+    if (nodes.count(node)) return;
+    nodes.insert(node);
+    for (auto &input : node.inputs()) collect(input, nodes);
+}
+
+static int count_transpose(const Module::shared &module) {
+    std::unordered_set<Node> nodes;
+    for (auto &output : module->outputs()) collect(output, nodes);
+    int count = 0;
+    for (auto &node : nodes) {
+        if (node.bubble().op() == name::layer::transpose()) ++count;
+    }
+    return count;
+}
+
+static Tensor run(const Module::shared &module, const std::string &options) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(bench->compile(module, options));
+    bench->input(0, values({2, 3, 4, 5}, 1));
+    bench->run();
+    return bench->output(0);
+}
+
+/**
+ * @return true if folded module has transposes number of transposes, and same output as unfolded one
+ */
+static bool check(const std::string &title, const Module::shared &module, int transposes) {
+    auto folded = Module::Translate(module, ComputingDevice(CPU), "--fold-transpose");
+    auto count = count_transpose(folded);
+    if (count != transposes) {
+        TS_LOG_INFO << title << ": " << count << " transpose(s) left, expected " << transposes;
+        return false;
+    }
+    auto lhs = run(module, "--fold-transpose");
+    auto rhs = run(module, "--no-fold-transpose");
+    if (lhs.sizes() != rhs.sizes()) {
+        TS_LOG_INFO << title << ": output shape changed";
+        return false;
+    }
+    for (int i = 0; i < lhs.count(); ++i) {
+        if (std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]) > 1e-6f) {
+            TS_LOG_INFO << title << ": output changed";
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    // output node is kept, so every case ends with an operator
+    auto round_trip = [](const Node &x) {
+        auto y = transpose("back", transpose("to", x, to_nhwc), to_nchw);
+        return bubble::op("y", name::layer::relu(), {y});
+    };
+    // composed into identity, then removed
+    TS_LOG_CHECKING(check("round trip", build(round_trip, true), 0));
+    // composed, but rank of x unknown, so identity is kept
+    TS_LOG_CHECKING(check("round trip of unknown rank", build(round_trip, false), 1));
+
+    auto rotate = [](const Node &x) {
+        auto y = transpose("second", transpose("first", x, to_nhwc), to_nhwc);
+        return bubble::op("y", name::layer::relu(), {y});
+    };
+    TS_LOG_CHECKING(check("composed", build(rotate, true), 1));
+
+    // identity with more dims prefix x's shape with 1
+    auto expand = [](const Node &x) {
+        auto y = transpose("expand", x, {0, 1, 2, 3, 4});
+        return bubble::op("y", name::layer::relu(), {y});
+    };
+    TS_LOG_CHECKING(check("identity to higher rank", build(expand, true), 1));
+    auto identity = [](const Node &x) {
+        auto y = transpose("identity", x, {0, 1, 2, 3});
+        return bubble::op("y", name::layer::relu(), {y});
+    };
+    TS_LOG_CHECKING(check("identity", build(identity, true), 0));
+
+    auto const_operand = [](const Node &x) {
+        auto c = bubble::data("c", values({5, 4}, 2));
+        return bubble::op("y", name::layer::add(), {x, transpose("c_t", c, {1, 0})});
+    };
+    TS_LOG_CHECKING(check("const", build(const_operand, false), 0));
+
+    // transposes meet through elementwise operators and cancel
+    auto sink = [](const Node &x) {
+        auto a = transpose("a", x, to_nhwc);
+        auto b = transpose("b", bubble::op("e", name::layer::exp(), {x}), to_nhwc);
+        auto m = bubble::op("m", name::layer::mul(), {a, b});
+        auto s = bubble::op("s", name::layer::sub(), {m, bubble::data("half", tensor::from<float>(0.5f))});
+        auto r = transpose("r_t", bubble::op("r", name::layer::relu(), {s}), to_nchw);
+        return bubble::op("y", name::layer::sigmoid(), {r});
+    };
+    TS_LOG_CHECKING(check("sink elementwise", build(sink, true), 0));
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f, float bias = 0.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale + bias;
+    return x;
+}
+
+static Node op(const std::string &name, const std::string &op, const std::vector<Node> &inputs) {
+    return bubble::op(name, op, inputs);
+}
+
+/**
+ * y = relu(x + b) * c, b is [1, C, 1, 1] and c is [W]
+ */
+static Node broadcast(const Node &x) {
+    auto b = bubble::data("b", values({1, 3, 1, 1}, 1));
+    auto c = bubble::data("c", values({40}, 2, 1.0f, 1.0f));
+    auto a = op("a", name::layer::add(), {x, b});
+    auto r = op("r", name::layer::relu(), {a});
+    return op("y", name::layer::mul(), {r, c});
+}
+
+/**
+ * y = 1 - sqrt(abs(x * 2) + 0.5) / 3
+ */
+static Node scalar(const Node &x) {
+    auto m = op("m", name::layer::mul(), {x, bubble::data("two", tensor::from<float>(2.0f))});
+    auto a = op("a", name::layer::abs(), {m});
+    auto h = op("h", name::layer::add(), {a, bubble::data("half", tensor::from<float>(0.5f))});
+    auto s = op("s", name::layer::sqrt(), {h});
+    auto d = op("d", name::layer::div(), {s, bubble::data("three", tensor::from<float>(3.0f))});
+    return op("y", name::layer::sub(), {bubble::data("one", tensor::from<float>(1.0f)), d});
+}
+
+/**
+ * y = maximum(sigmoid(x - c), tanh(x)) * exp(rsqrt(square(x) + 1)), x is read by three branches
+ */
+static Node mixed(const Node &x) {
+    auto c = bubble::data("c", values({40}, 3));
+    auto s = op("s", name::layer::sigmoid(), {op("sub", name::layer::sub(), {x, c})});
+    auto t = op("t", name::layer::tanh(), {x});
+    auto m = op("m", name::layer::maximum(), {s, t});
+    auto q = op("q", name::layer::square(), {x});
+    auto r = op("r", name::layer::rsqrt(), {op("add", name::layer::add(), {q, bubble::data("one", tensor::from<float>(1.0f))})});
+    return op("y", name::layer::mul(), {m, op("e", name::layer::exp(), {r})});
+}
+
+/**
+ * y = a * a + x, a = sigmoid(x), a is read twice by one node
+ */
+static Node shared(const Node &x) {
+    auto a = op("a", name::layer::sigmoid(), {x});
+    auto s = op("s", name::layer::mul(), {a, a});
+    return op("y", name::layer::add(), {s, x});
+}
+
+template <typename Chain>
+static Module::shared build(Chain chain) {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    return Module::Load(g, {chain(x)});
+}
+
+static int count_op(const Program &program, const std::string &op) {
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "add(in=2, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static float max_diff(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return INFINITY;
+    float diff = 0;
+    for (int i = 0; i < lhs.count(); ++i) {
+        diff = std::max(diff, std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]));
+    }
+    return diff;
+}
+
+/**
+ * @return true if module compiled with and without --fuse-elementwise have same output,
+ *     and only fused one is one _fused_elementwise
+ */
+template <typename Chain>
+static bool check(const std::string &title, Chain chain, const Tensor &x) {
+    auto fused = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto fused_program = fused->compile(build(chain), "--fuse-elementwise");
+    fused->setup(fused_program);
+    auto unfused = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto unfused_program = unfused->compile(build(chain), "");
+    unfused->setup(unfused_program);
+
+    bool succeed = true;
+    if (count_op(*fused_program, name::layer::fused_elementwise()) != 1) {
+        TS_LOG_INFO << title << ": not fused into one operator";
+        succeed = false;
+    }
+    if (count_op(*unfused_program, name::layer::fused_elementwise()) != 0) {
+        TS_LOG_INFO << title << ": fused without --fuse-elementwise";
+        succeed = false;
+    }
+
+    fused->input(0, x);
+    fused->run();
+    unfused->input(0, x);
+    unfused->run();
+    auto diff = max_diff(fused->output(0), unfused->output(0));
+    TS_LOG_INFO << title << ": max diff " << diff;
+    return succeed && diff < 1e-5f;
+}
+
+int main() {
+    // 9600 elements, more than one 1024 elements block
+    auto large = values({2, 3, 40, 40}, 0, 4.0f);
+    // less than one block
+    auto small = values({1, 3, 4, 40}, 5, 4.0f);
+
+    TS_LOG_CHECKING(check("broadcast", broadcast, large));
+    TS_LOG_CHECKING(check("broadcast", broadcast, small));
+    TS_LOG_CHECKING(check("scalar", scalar, large));
+    TS_LOG_CHECKING(check("scalar", scalar, small));
+    TS_LOG_CHECKING(check("mixed", mixed, large));
+    TS_LOG_CHECKING(check("mixed", mixed, small));
+    TS_LOG_CHECKING(check("shared", shared, large));
+    TS_LOG_CHECKING(check("shared", shared, small));
+
+    return 0;
+}
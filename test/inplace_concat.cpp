@@ -0,0 +1,111 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale;
+    return x;
+}
+
+/**
+ * y = concat(relu(x), conv2d(x), reshape(sigmoid(x))) on channels, x is [N, 3, 8, 8].
+ * conv2d has 27 output channels, so its im2col buffer has the same size as its output
+ */
+static Module::shared concat_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto a = bubble::op("a", name::layer::relu(), {x});
+    auto w = bubble::data("w", values({27, 3, 3, 3}, 1, 0.5f));
+    auto b = bubble::op("b", name::layer::conv2d(), {x, w});
+    b.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+    b.bubble().set(name::format, tensor::from(name::NCHW));
+    b.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    b.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    auto s = bubble::op("s", name::layer::sigmoid(), {x});
+    auto c = bubble::op("c", name::layer::reshape(), {s});
+    c.bubble().set(name::shape, tensor::from(std::vector<int32_t>{-1, 3, 8, 8}));
+    auto y = bubble::op("y", name::layer::concat(), {a, b, c});
+    y.bubble().set(name::dim, tensor::from<int32_t>(1));
+    return Module::Load(g, {y});
+}
+
+static ConcatBuffer::shared concat_buffer(const Program &program) {
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst != nullptr && op_inst->concat_buffer() != nullptr) return op_inst->concat_buffer();
+    }
+    return nullptr;
+}
+
+static Tensor run(Workbench &bench, const Tensor &x) {
+    bench.input(0, x);
+    bench.run();
+    return bench.output(0);
+}
+
+static bool same(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return false;
+    for (int i = 0; i < lhs.count(); ++i) {
+        if (std::fabs(lhs.data<float>()[i] - rhs.data<float>()[i]) > 1e-5f) return false;
+    }
+    return true;
+}
+
+int main() {
+    auto module = concat_module();
+
+    auto inplace = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto program = inplace->compile(module, "--inplace-concat");
+    inplace->setup(program);
+    auto copying = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto copying_program = copying->compile(module, "--no-inplace-concat");
+    copying->setup(copying_program);
+
+    auto buffer = concat_buffer(*program);
+    TS_LOG_CHECKING(buffer != nullptr);
+    TS_LOG_CHECKING(concat_buffer(*copying_program) == nullptr);
+    TS_LOG_CHECKING(concat_buffer(*inplace->compile(module, "")) == nullptr);
+    if (buffer == nullptr) return 0;
+
+    // outputs of former runs are kept, to check buffer of each run is not shared
+    std::vector<Tensor> outputs;
+    std::vector<Tensor> expected;
+    int seed = 0;
+    for (int batch : {1, 1, 1, 2, 2, 1, 1}) {
+        auto x = values({batch, 3, 8, 8}, seed++, 4.0f);
+        outputs.push_back(run(*inplace, x));
+        expected.push_back(run(*copying, x));
+    }
+    bool all_same = true;
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        if (!same(outputs[i], expected[i])) {
+            TS_LOG_INFO << "run " << i << " differs";
+            all_same = false;
+        }
+    }
+    TS_LOG_CHECKING(all_same);
+
+    // im2col buffer of conv2d has the size of its output, but does not take the slice
+    TS_LOG_CHECKING(buffer->ready());
+    TS_LOG_CHECKING(outputs[1].data() != outputs[2].data());
+
+    return 0;
+}
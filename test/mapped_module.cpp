@@ -0,0 +1,113 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <module/io/mstream.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <cstdio>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale;
+    return x;
+}
+
+/**
+ * y = relu(conv2d(x, w) + b)
+ */
+static Module::shared conv_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto w = bubble::data("w", values({8, 3, 3, 3}, 1, 0.5f));
+    auto conv = bubble::op("conv", name::layer::conv2d(), {x, w});
+    conv.bubble().set(name::padding, tensor::build(INT32, {4, 2}, std::vector<int32_t>{0, 0, 0, 0, 1, 1, 1, 1}));
+    conv.bubble().set(name::format, tensor::from(name::NCHW));
+    conv.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    conv.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+    auto add = bubble::op("add", name::layer::add(), {conv, bubble::data("b", values({1, 8, 1, 1}, 2))});
+    auto y = bubble::op("y", name::layer::relu(), {add});
+    return Module::Load(g, {y});
+}
+
+static Tensor run(const Module::shared &module) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(bench->compile(module, ""));
+    bench->input(0, values({2, 3, 8, 8}, 3, 4.0f));
+    bench->run();
+    return bench->output(0);
+}
+
+static bool same(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return false;
+    for (int i = 0; i < lhs.count(); ++i) {
+        if (lhs.data<float>()[i] != rhs.data<float>()[i]) return false;
+    }
+    return true;
+}
+
+/**
+ * @return count of constants, and count of them in mapping
+ */
+static std::pair<int, int> count_mapped(const Module::shared &module) {
+    int constants = 0;
+    int mapped = 0;
+    for (auto &graph : module->graphs()) {
+        for (auto &node : graph.nodes()) {
+            if (node.bubble().op() != Bubble::Const) continue;
+            ++constants;
+            if (MappedStreamReader::Mapped(node.bubble().get(name::value).data())) ++mapped;
+        }
+    }
+    return std::make_pair(constants, mapped);
+}
+
+int main() {
+    const std::string aligned_path = "mapped_module_test.aligned.tsm";
+    const std::string binary_path = "mapped_module_test.tsm";
+
+    Module::Save(aligned_path, conv_module(), Module::ALIGNED_BINARY);
+    Module::Save(binary_path, conv_module(), Module::BINARY);
+
+    auto expected = run(Module::Load(binary_path));
+
+    {
+        auto mapped = Module::LoadMapped(aligned_path, Module::ALIGNED_BINARY);
+        // constants are views of mapping, no copy
+        auto count = count_mapped(mapped);
+        TS_LOG_CHECKING(count.first == 2);
+        TS_LOG_CHECKING(count.second == count.first);
+        TS_LOG_CHECKING(same(run(mapped), expected));
+        // run again, mapping kept alive by constants
+        TS_LOG_CHECKING(same(run(mapped), expected));
+    }
+
+    // aligned file also loads by stream
+    TS_LOG_CHECKING(same(run(Module::Load(aligned_path, Module::ALIGNED_BINARY)), expected));
+
+    // plain binary file loads by mapping, but constants are read as copies
+    {
+        auto mapped = Module::LoadMapped(binary_path, Module::BINARY);
+        auto count = count_mapped(mapped);
+        TS_LOG_CHECKING(count.first == 2);
+        TS_LOG_CHECKING(count.second == 0);
+        TS_LOG_CHECKING(same(run(mapped), expected));
+    }
+
+    std::remove(aligned_path.c_str());
+    std::remove(binary_path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <kernels/cpu/memory_cpu.h>
+#include <global/hard_allocator.h>
+#include <global/setup.h>
+#include <utils/platform.h>
+
+#include <utils/log.h>
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static const size_t MB = size_t(1) << 20;
+
+static bool aligned(const void *data, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(data) % alignment == 0;
+}
+
+static void fill(void *data, size_t size) {
+    auto bytes = reinterpret_cast<uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) bytes[i] = uint8_t(i % 251);
+}
+
+static bool filled(const void *data, size_t size) {
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        if (bytes[i] != uint8_t(i % 251)) return false;
+    }
+    return true;
+}
+
+/**
+ * @return true if memory in mapping advised with huge pages, or huge pages not supported
+ */
+static bool advised_huge_page(const void *data) {
+#if TS_PLATFORM_OS_LINUX
+    std::ifstream thp("/sys/kernel/mm/transparent_hugepage/enabled");
+    if (!thp.is_open()) return true;
+    std::ifstream smaps("/proc/self/smaps");
+    if (!smaps.is_open()) return true;
+    auto addr = reinterpret_cast<uintptr_t>(data);
+    bool found = false;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        uintptr_t begin = 0, end = 0;
+        char dash = 0;
+        std::istringstream head(line);
+        if (head >> std::hex >> begin >> dash >> end && dash == '-') {
+            found = begin <= addr && addr < end;
+            continue;
+        }
+        if (found && line.compare(0, 8, "VmFlags:") == 0) {
+            return line.find(" hg") != std::string::npos;
+        }
+    }
+    return false;
+#else
+    (void)(data);
+    return true;
+#endif
+}
+
+int main() {
+    setup();
+    auto allocator = HardAllocator::Query(CPU);
+
+    // every block is 64 bytes aligned
+    bool all_aligned = true;
+    for (size_t size : {size_t(1), size_t(63), size_t(100), size_t(4096), size_t(200000), 3 * MB}) {
+        auto data = allocator(0, size, nullptr, 0);
+        if (!aligned(data, 64)) all_aligned = false;
+        fill(data, size);
+        allocator(0, 0, data, 0);
+    }
+    TS_LOG_CHECKING(all_aligned);
+
+    // resized block keeps content and alignment
+    {
+        auto data = allocator(0, 1000, nullptr, 0);
+        fill(data, 1000);
+        data = allocator(0, 500, data, 1000);
+        TS_LOG_CHECKING(aligned(data, 64) && filled(data, 500));
+        data = allocator(0, 300000, data, 500);
+        TS_LOG_CHECKING(aligned(data, 64) && filled(data, 500));
+        allocator(0, 0, data, 0);
+    }
+
+#if TS_PLATFORM_OS_LINUX
+    // block not smaller than 2MB is mapped on huge page boundary, with placement bound
+    {
+        CpuMemoryPlacement placement;
+        placement.huge_page = true;
+        ctx::bind<CpuMemoryPlacement> _bind_placement(placement);
+
+        auto data = allocator(0, 3 * MB, nullptr, 0);
+        TS_LOG_CHECKING(aligned(reinterpret_cast<char *>(data) - 64, 2 * MB));
+        TS_LOG_CHECKING(advised_huge_page(data));
+        fill(data, 3 * MB);
+
+        // resized in place, mapping is rounded up to 4MB
+        auto resized = allocator(0, 3 * MB + MB / 2, data, 3 * MB);
+        TS_LOG_CHECKING(resized == data);
+        TS_LOG_CHECKING(filled(resized, 3 * MB));
+
+        // moved to new mapping, content kept
+        auto moved = allocator(0, 5 * MB, resized, 3 * MB + MB / 2);
+        TS_LOG_CHECKING(aligned(reinterpret_cast<char *>(moved) - 64, 2 * MB));
+        TS_LOG_CHECKING(filled(moved, 3 * MB));
+        allocator(0, 0, moved, 0);
+    }
+
+    // or with huge pages enabled in whole process
+    {
+        cpu_set_huge_page(true);
+        auto data = allocator(0, 2 * MB, nullptr, 0);
+        TS_LOG_CHECKING(aligned(reinterpret_cast<char *>(data) - 64, 2 * MB));
+        fill(data, 2 * MB);
+        allocator(0, 0, data, 0);
+        cpu_set_huge_page(false);
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <backend/common_structure.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+using Layer = std::function<Node(const Node &)>;
+
+static Tensor values(const Shape &shape, int seed, float scale = 1.0f) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = (float((i * 7 + seed) % 13) / 13.0f - 0.5f) * scale;
+    return x;
+}
+
+static Tensor padding(const std::vector<int32_t> &padding) {
+    return tensor::build(INT32, {4, 2}, padding);
+}
+
+static Node pad(const Node &x, const std::vector<int32_t> &pads, float value) {
+    auto node = bubble::op("pad", name::layer::pad(), {x, bubble::data("pads", padding(pads))});
+    node.bubble().set(name::padding_value, tensor::from<float>(value));
+    return node;
+}
+
+static Layer conv2d(const std::vector<int32_t> &pads, float padding_value) {
+    return [=](const Node &x) {
+        auto w = bubble::data("w", values({5, 3, 3, 3}, 1, 0.5f));
+        auto node = bubble::op("conv", name::layer::conv2d(), {x, w});
+        node.bubble().set(name::padding, padding(pads));
+        node.bubble().set(name::padding_value, tensor::from<float>(padding_value));
+        node.bubble().set(name::format, tensor::from(name::NCHW));
+        node.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+        node.bubble().set(name::dilation, tensor::from(std::vector<int32_t>{1, 1, 1, 1}));
+        return node;
+    };
+}
+
+static Layer pooling2d(Pooling2DType type, Padding2DType padding_type, const std::vector<int32_t> &pads) {
+    return [=](const Node &x) {
+        auto node = bubble::op("pool", name::layer::pooling2d(), {x});
+        node.bubble().set(name::format, tensor::from(name::NCHW));
+        node.bubble().set(name::type, tensor::from(int32_t(type)));
+        node.bubble().set(name::padding_type, tensor::from(int32_t(padding_type)));
+        node.bubble().set(name::padding, padding(pads));
+        node.bubble().set(name::ksize, tensor::from(std::vector<int32_t>{1, 1, 3, 3}));
+        node.bubble().set(name::stride, tensor::from(std::vector<int32_t>{1, 1, 2, 2}));
+        return node;
+    };
+}
+
+/**
+ * y = layer(pad(x))
+ * @param shared if true, padded tensor is also an output, so pad has two consumers
+ */
+static Module::shared build(const Layer &layer, const std::vector<int32_t> &pads, float value, bool shared) {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto padded = pad(x, pads, value);
+    auto y = layer(padded);
+    if (shared) return Module::Load(g, {y, padded});
+    return Module::Load(g, {y});
+}
+
+static int count_pad(const Program &program) {
+    std::string op = name::layer::pad();
+    int count = 0;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        // description is like "pad(in=2, out=1)"
+        if (op_inst->description().compare(0, op.size() + 1, op + "(") == 0) ++count;
+    }
+    return count;
+}
+
+static Tensor run(const Program::shared &program) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(program);
+    bench->input(0, values({2, 3, 9, 10}, 2, 4.0f));
+    bench->run();
+    return bench->output(0);
+}
+
+static bool same(const Tensor &lhs, const Tensor &rhs) {
+    if (lhs.sizes() != rhs.sizes()) return false;
+    for (int i = 0; i < lhs.count(); ++i) {
+        auto a = lhs.data<float>()[i];
+        auto b = rhs.data<float>()[i];
+        if (a == b) continue;
+        if (std::fabs(a - b) > 1e-5f) return false;
+    }
+    return true;
+}
+
+/**
+ * @param folded if pad is expected to be folded into layer
+ * @return true if pad is folded as expected, and output is same as pad computed by itself
+ */
+static bool check(const std::string &title, const Layer &layer,
+                  const std::vector<int32_t> &pads, float value, bool folded) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto program = bench->compile(build(layer, pads, value, false), "");
+    auto reference = bench->compile(build(layer, pads, value, true), "");
+    if (count_pad(*reference) != 1) {
+        TS_LOG_INFO << title << ": pad with two consumers folded";
+        return false;
+    }
+    if (count_pad(*program) != (folded ? 0 : 1)) {
+        TS_LOG_INFO << title << ": pad " << (folded ? "not folded" : "folded");
+        return false;
+    }
+    if (!same(run(program), run(reference))) {
+        TS_LOG_INFO << title << ": output changed";
+        return false;
+    }
+    return true;
+}
+
+int main() {
+    auto inf = -std::numeric_limits<float>::infinity();
+    std::vector<int32_t> spatial = {0, 0, 0, 0, 1, 2, 2, 1};
+    std::vector<int32_t> channel = {0, 0, 1, 0, 1, 1, 1, 1};
+    std::vector<int32_t> none = {0, 0, 0, 0, 0, 0, 0, 0};
+    std::vector<int32_t> one = {0, 0, 0, 0, 1, 1, 1, 1};
+    std::vector<int32_t> begin = {0, 0, 0, 0, 2, 1, 1, 0};
+    std::vector<int32_t> small = {0, 0, 0, 0, 1, 0, 0, 0};
+
+    // conv takes padding_value of pad
+    TS_LOG_CHECKING(check("conv", conv2d(none, 0), spatial, 0.5f, true));
+    TS_LOG_CHECKING(check("conv with same padding_value", conv2d(one, 0.5f), spatial, 0.5f, true));
+    TS_LOG_CHECKING(check("conv with other padding_value", conv2d(one, 0), spatial, 0.5f, false));
+
+    // max pooling takes -inf padding, if each window still covers input
+    TS_LOG_CHECKING(check("max pooling", pooling2d(Pooling2DType::MAX, Padding2DType::BLACK, none), begin, inf, true));
+    TS_LOG_CHECKING(check("max pooling with padding", pooling2d(Pooling2DType::MAX, Padding2DType::BLACK, one), small, inf, true));
+    TS_LOG_CHECKING(check("max pooling with window in padding", pooling2d(Pooling2DType::MAX, Padding2DType::BLACK, none), spatial, inf, false));
+    TS_LOG_CHECKING(check("max pooling pad 0", pooling2d(Pooling2DType::MAX, Padding2DType::BLACK, none), begin, 0, false));
+    TS_LOG_CHECKING(check("white avg pooling", pooling2d(Pooling2DType::AVG, Padding2DType::WHITE, none), spatial, 0, true));
+    TS_LOG_CHECKING(check("black avg pooling", pooling2d(Pooling2DType::AVG, Padding2DType::BLACK, none), spatial, 0, false));
+
+    // padding of N and C can not be taken by padding of layer
+    TS_LOG_CHECKING(check("channel pad", pooling2d(Pooling2DType::AVG, Padding2DType::WHITE, none), channel, 0, false));
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+//
+// Created by agent on 2026/10/16.
+//
+
+#include <memory/planner.h>
+
+#include <utils/log.h>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+int main() {
+    using namespace ts;
+    MemoryDevice device(CPU, 0);
+
+    PlannedMemoryController controller(device);
+
+    auto run = [&]() -> std::vector<void *> {
+        std::vector<void *> ptrs;
+        auto a = controller.alloc(100);
+        auto b = controller.alloc(200);
+        ptrs.push_back(a.data());
+        ptrs.push_back(b.data());
+        a = Memory();
+        auto c = controller.alloc(64);  // can reuse a
+        ptrs.push_back(c.data());
+        return ptrs;
+    };
+
+    controller.record();
+    run();
+    auto plan = controller.finish();
+
+    TS_LOG_CHECKING(plan != nullptr);
+    TS_LOG_CHECKING(plan->count() == 3);
+    TS_LOG_CHECKING(plan->arena_size() < plan->total_size());
+    TS_LOG_CHECKING(plan->block(2).offset == plan->block(0).offset);
+
+    controller.replay(plan);
+    auto first = run();
+    controller.finish();
+    TS_LOG_CHECKING(controller.missed() == 0);
+    TS_LOG_CHECKING(first[0] == first[2]);
+
+    controller.replay(plan);
+    auto second = run();
+    controller.finish();
+    TS_LOG_CHECKING(controller.missed() == 0);
+    TS_LOG_CHECKING(first[1] == second[1]);
+
+    // keep memory over plan
+    controller.replay(plan);
+    auto a = controller.alloc(100);
+    auto b = controller.alloc(200);
+    auto c = controller.alloc(64);
+    controller.finish();
+    TS_LOG_CHECKING(controller.missed() == 1);
+    TS_LOG_CHECKING(a.data() != c.data());
+
+    return 0;
+}
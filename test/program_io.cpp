@@ -0,0 +1,166 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/program.h>
+#include <runtime/instruction.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = reshape(concat(relu(x), sigmoid(x)), [1, -1]) + 1
+ * relu and sigmoid write into slices of concat, reshape is a view
+ */
+static Module::shared concat_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto a = bubble::op("a", name::layer::relu(), {x});
+    auto b = bubble::op("b", name::layer::sigmoid(), {x});
+    auto c = bubble::op("c", name::layer::concat(), {a, b});
+    c.bubble().set(name::dim, tensor::from<int32_t>(1));
+    auto r = bubble::op("r", name::layer::reshape(), {c});
+    r.bubble().set(name::shape, tensor::from(std::vector<int32_t>{1, -1}));
+    auto y = bubble::op("y", name::layer::add(), {r, bubble::data("one", tensor::from<float>(1.0f))});
+    return Module::Load(g, {y});
+}
+
+static Tensor input() {
+    Tensor x(FLOAT32, {1, 3, 4, 4});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+class Bindings {
+public:
+    int views = 0;
+    int concat_buffers = 0;
+    int concat_slices = 0;
+
+    bool operator==(const Bindings &other) const {
+        return views == other.views && concat_buffers == other.concat_buffers && concat_slices == other.concat_slices;
+    }
+};
+
+static Bindings bindings(const Program &program) {
+    Bindings bindings;
+    for (auto &inst : program.instruction()) {
+        auto op_inst = std::dynamic_pointer_cast<OperatorInstruction>(inst);
+        if (op_inst == nullptr) continue;
+        if (op_inst->is_view()) ++bindings.views;
+        if (op_inst->concat_buffer() != nullptr) ++bindings.concat_buffers;
+        if (op_inst->concat_slice() != nullptr) ++bindings.concat_slices;
+    }
+    return bindings;
+}
+
+static Tensor run(Workbench &bench, Program::shared program) {
+    bench.setup(program);
+    bench.input(0, input());
+    bench.run();
+    return bench.output(0);
+}
+
+/**
+ * @return if load throws Exception
+ */
+static bool load_throws(Workbench &bench, const std::string &filename, const ComputingDevice &device,
+                        const std::string &options) {
+    ctx::bind<Workbench> _bind_bench(bench);
+    try {
+        Program::Load(filename, device, options);
+    } catch (const Exception &) {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * write copy of filename to patched, with bytes at offset of library version changed
+ * @param skip bytes skipped after start of library version
+ */
+static void patch_version(const std::string &filename, const std::string &patched, size_t skip) {
+    std::ifstream in(filename, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    auto pos = bytes.find(TS_LIBRARY_VERSION);
+    if (pos != std::string::npos) bytes[pos + skip] ^= 0x7f;
+    std::ofstream out(patched, std::ios::binary);
+    out.write(bytes.data(), bytes.size());
+}
+
+int main() {
+    const std::string filename = "program_io.tsp";
+    const std::string options = "--pack  --inplace-concat";
+
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto program = bench->compile(concat_module(), options);
+    Program::Save(filename, program);
+
+    Program::shared loaded;
+    {
+        ctx::bind<Workbench> _bind_bench(bench.get());
+        // options are compared after split by spaces
+        loaded = Program::Load(filename, ComputingDevice(CPU), "--pack --inplace-concat");
+    }
+
+    auto expected = bindings(*program);
+    TS_LOG_CHECKING(expected.views == 1);
+    TS_LOG_CHECKING(expected.concat_buffers == 1);
+    TS_LOG_CHECKING(expected.concat_slices == 2);
+    TS_LOG_CHECKING(bindings(*loaded) == expected);
+
+    auto lhs = run(*bench, program);
+    auto loaded_bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto rhs = run(*loaded_bench, loaded);
+    bool same = lhs.sizes() == rhs.sizes();
+    for (int i = 0; same && i < lhs.count(); ++i) {
+        if (lhs.data<float>()[i] != rhs.data<float>()[i]) same = false;
+    }
+    TS_LOG_CHECKING(same);
+
+    // saved program is loaded again, output still same
+    {
+        ctx::bind<Workbench> _bind_bench(loaded_bench.get());
+        Program::Save(filename, loaded);
+        loaded = Program::Load(filename, ComputingDevice(CPU), options);
+    }
+    auto again = run(*loaded_bench, loaded);
+    same = lhs.sizes() == again.sizes();
+    for (int i = 0; same && i < lhs.count(); ++i) {
+        if (lhs.data<float>()[i] != again.data<float>()[i]) same = false;
+    }
+    TS_LOG_CHECKING(same);
+
+    TS_LOG_CHECKING(load_throws(*bench, filename, ComputingDevice(CPU, 1), options));
+    TS_LOG_CHECKING(load_throws(*bench, filename, ComputingDevice(CPU), "--no-pack --inplace-concat"));
+    TS_LOG_CHECKING(load_throws(*bench, filename, ComputingDevice(CPU), ""));
+    TS_LOG_CHECKING(load_throws(*bench, "not_exist.tsp", ComputingDevice(CPU), options));
+
+    // saved by other library or in other format
+    const std::string patched = "program_io_patched.tsp";
+    patch_version(filename, patched, 0);
+    TS_LOG_CHECKING(load_throws(*bench, patched, ComputingDevice(CPU), options));
+    patch_version(filename, patched, std::strlen(TS_LIBRARY_VERSION));
+    TS_LOG_CHECKING(load_throws(*bench, patched, ComputingDevice(CPU), options));
+
+    std::remove(patched.c_str());
+    std::remove(filename.c_str());
+
+    return 0;
+}
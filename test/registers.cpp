@@ -0,0 +1,142 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/instruction.h>
+#include <board/hook.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <sstream>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+static Tensor values(const Shape &shape, int seed) {
+    Tensor x(FLOAT32, shape);
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+/**
+ * inputs x, z, outputs y = reshape(concat(relu(x), sigmoid(x + c)), [1, -1]) * 2 and z - square(x)
+ * concat of relu and sigmoid can be bound to concat buffer with --inplace-concat
+ */
+static Module::shared branchy_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto z = bubble::param("z");
+    auto a = bubble::op("a", name::layer::relu(), {x});
+    auto b = bubble::op("b", name::layer::sigmoid(), {
+            bubble::op("xc", name::layer::add(), {x, bubble::data("c", values({1, 3, 1, 1}, 1))})});
+    auto c = bubble::op("concat", name::layer::concat(), {a, b});
+    c.bubble().set(name::dim, tensor::from<int32_t>(1));
+    auto r = bubble::op("r", name::layer::reshape(), {c});
+    r.bubble().set(name::shape, tensor::from(std::vector<int32_t>{1, -1}));
+    auto y = bubble::op("y", name::layer::mul(), {r, bubble::data("two", tensor::from<float>(2.0f))});
+    auto w = bubble::op("w", name::layer::sub(), {z, bubble::op("t", name::layer::square(), {x})});
+    return Module::Load(g, {y, w});
+}
+
+static std::vector<Tensor> run(Workbench &bench, int seed) {
+    bench.input(0, values({1, 3, 4, 4}, seed));
+    bench.input(1, values({1, 3, 4, 4}, seed + 1));
+    bench.run();
+    return {bench.output(0).clone(), bench.output(1).clone()};
+}
+
+static bool same(const std::vector<Tensor> &lhs, const std::vector<Tensor> &rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].sizes() != rhs[i].sizes()) return false;
+        for (int j = 0; j < lhs[i].count(); ++j) {
+            if (lhs[i].data<float>()[j] != rhs[i].data<float>()[j]) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @return true if program compiled with options and --registers has the same outputs as interpreter,
+ *     in some runs with different inputs
+ */
+static bool check(const std::string &options) {
+    auto registers = std::make_shared<Workbench>(ComputingDevice(CPU));
+    registers->setup(registers->compile(branchy_module(), "--registers " + options));
+    auto interpreter = std::make_shared<Workbench>(ComputingDevice(CPU));
+    interpreter->setup(interpreter->compile(branchy_module(), options));
+    for (int seed = 0; seed < 3; ++seed) {
+        if (!same(run(*registers, seed), run(*interpreter, seed))) return false;
+    }
+    return true;
+}
+
+/**
+ * @return count of register steps running operator directly
+ */
+static int direct_steps(const Program &program) {
+    auto registers = program.register_program();
+    if (registers == nullptr) return 0;
+    int count = 0;
+    for (auto &step : registers->steps()) {
+        if (step.op != nullptr) ++count;
+    }
+    return count;
+}
+
+int main() {
+    TS_LOG_CHECKING(check(""));
+    TS_LOG_CHECKING(check("--no-pack"));
+
+    // steps bound to concat buffer run by instruction
+    TS_LOG_CHECKING(check("--inplace-concat"));
+    {
+        auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+        auto plain = bench->compile(branchy_module(), "--registers");
+        auto inplace = bench->compile(branchy_module(), "--registers --inplace-concat");
+        // relu, sigmoid and concat
+        TS_LOG_CHECKING(direct_steps(*plain) - direct_steps(*inplace) == 3);
+    }
+
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    auto program = bench->compile(branchy_module(), "--registers");
+    bench->setup(program);
+    auto expected = run(*bench, 0);
+    int operators = 0;
+    for (auto &inst : program->instruction()) {
+        if (std::dynamic_pointer_cast<OperatorInstruction>(inst) != nullptr) ++operators;
+    }
+
+    // hook bound, falls back to interpreter, which emits hook for each operator
+    {
+        int emitted = 0;
+        Hook hook;
+        hook.before_run([&](const Hook::StructBeforeRun &) { ++emitted; });
+        ctx::bind<Hook> _bind_hook(hook);
+        TS_LOG_CHECKING(same(run(*bench, 0), expected));
+        TS_LOG_CHECKING(emitted == operators);
+    }
+
+    // profiler bound, falls back to interpreter, which times each operator
+    {
+        bench->do_profile(true);
+        TS_LOG_CHECKING(same(run(*bench, 0), expected));
+        bench->do_profile(false);
+        std::ostringstream log;
+        bench->profiler().log(log);
+        TS_LOG_CHECKING(log.str().find("op(") != std::string::npos);
+    }
+
+    TS_LOG_CHECKING(same(run(*bench, 0), expected));
+
+    return 0;
+}
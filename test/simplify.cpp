@@ -0,0 +1,125 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <unordered_set>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * inputs are y, x. a = sigmoid(x + 1) is built twice, with two copies of 1
+ * outputs are o1 = relu(y - a * a'), o2 = relu(y - a * a') and a
+ * dead = tanh(x) is not used by any output
+ */
+static Module::shared duplicated_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto y = bubble::param("y");
+    auto a1 = bubble::op("a1", name::layer::sigmoid(), {
+            bubble::op("add1", name::layer::add(), {x, bubble::data("one1", tensor::from<float>(1.0f))})});
+    auto a2 = bubble::op("a2", name::layer::sigmoid(), {
+            bubble::op("add2", name::layer::add(), {x, bubble::data("one2", tensor::from<float>(1.0f))})});
+    auto d = bubble::op("d", name::layer::sub(), {y, bubble::op("m", name::layer::mul(), {a1, a2})});
+    auto o1 = bubble::op("o1", name::layer::relu(), {d});
+    auto o2 = bubble::op("o2", name::layer::relu(), {d});
+    bubble::op("dead", name::layer::tanh(), {x});
+    auto module = Module::Load(g, {o1, o2, a1});
+    module->sort_inputs({"y", "x"});
+    return module;
+}
+
+static void collect(const Node &node, std::unordered_set<Node> &nodes) {
+    if (nodes.count(node)) return;
+    nodes.insert(node);
+    for (auto &input : node.inputs()) collect(input, nodes);
+}
+
+/**
+ * @return count of nodes reachable from outputs, named name or running op
+ */
+static int count(const Module::shared &module, const std::string &name, const std::string &op = "") {
+    std::unordered_set<Node> nodes;
+    for (auto &output : module->outputs()) collect(output, nodes);
+    int count = 0;
+    for (auto &node : nodes) {
+        if (node.bubble().name() == name || node.bubble().op() == op) ++count;
+    }
+    return count;
+}
+
+static std::vector<std::string> names(const std::vector<Node> &nodes) {
+    std::vector<std::string> names;
+    for (auto &node : nodes) names.push_back(node.bubble().name());
+    return names;
+}
+
+static Tensor values(int seed) {
+    Tensor x(FLOAT32, {2, 3, 4, 4});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+static std::vector<Tensor> run(const Module::shared &module, const std::string &options) {
+    auto bench = std::make_shared<Workbench>(ComputingDevice(CPU));
+    bench->setup(bench->compile(module, options));
+    bench->input(0, values(1));
+    bench->input(1, values(2));
+    bench->run();
+    std::vector<Tensor> outputs;
+    for (int i = 0; i < bench->output_count(); ++i) outputs.push_back(bench->output(i));
+    return outputs;
+}
+
+static bool same(const std::vector<Tensor> &lhs, const std::vector<Tensor> &rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].sizes() != rhs[i].sizes()) return false;
+        for (int j = 0; j < lhs[i].count(); ++j) {
+            if (std::fabs(lhs[i].data<float>()[j] - rhs[i].data<float>()[j]) > 1e-6f) return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    auto module = duplicated_module();
+    ComputingDevice device(CPU);
+    auto simplified = Module::Translate(module, device, "--simplify");
+    auto original = Module::Translate(module, device, "--no-simplify");
+
+    // unreachable node removed
+    TS_LOG_CHECKING(count(simplified, "dead") == 0);
+
+    // duplicated subgraph merged, including constants
+    TS_LOG_CHECKING(count(original, "", name::layer::add()) == 2);
+    TS_LOG_CHECKING(count(simplified, "", name::layer::add()) == 1);
+    TS_LOG_CHECKING(count(simplified, "", name::layer::sigmoid()) == 1);
+    TS_LOG_CHECKING(count(simplified, "", Bubble::Const) == 1);
+
+    // output nodes kept, even if same as each other
+    TS_LOG_CHECKING(names(simplified->outputs()) == std::vector<std::string>({"o1", "o2", "a1"}));
+    TS_LOG_CHECKING(simplified->output(0) != simplified->output(1));
+    TS_LOG_CHECKING(count(simplified, "", name::layer::relu()) == 2);
+
+    // input order kept
+    TS_LOG_CHECKING(names(simplified->inputs()) == std::vector<std::string>({"y", "x"}));
+    TS_LOG_CHECKING(names(original->inputs()) == std::vector<std::string>({"y", "x"}));
+
+    // same result
+    TS_LOG_CHECKING(same(run(module, "--simplify"), run(module, "--no-simplify")));
+
+    return 0;
+}
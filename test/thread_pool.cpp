@@ -0,0 +1,194 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include "runtime/inside/thread_pool.h"
+
+#include "utils/log.h"
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <set>
+#include <stdexcept>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * every task runs tasks of next level and joins them in working thread
+ */
+static void nested(ThreadPool &pool, std::atomic<int> &count, int depth) {
+    count.fetch_add(1);
+    if (depth == 0) return;
+    ThreadPool::Group group;
+    for (int i = 0; i < 4; ++i) {
+        pool.run(group, [&pool, &count, depth](int) { nested(pool, count, depth - 1); });
+    }
+    pool.join(group);
+}
+
+void test_nesting() {
+    ThreadPool pool(4);
+    for (int round = 0; round < 20; ++round) {
+        std::atomic<int> count(0);
+        pool.run([&](int) { nested(pool, count, 4); });
+        pool.join();
+        // 1 + 4 + 16 + 64 + 256
+        if (count.load() != 341) {
+            TS_LOG_CHECKING(count.load() == 341);
+            return;
+        }
+    }
+    TS_LOG_CHECKING(!pool.busy());
+}
+
+void test_stealing() {
+    ThreadPool pool(4);
+    std::mutex mutex;
+    std::set<int> signets;
+    std::atomic<int> count(0);
+    // all tasks pushed on deque of one worker, others can only steal them
+    pool.run([&](int) {
+        ThreadPool::Group group;
+        for (int i = 0; i < 64; ++i) {
+            pool.run(group, [&](int signet) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                count.fetch_add(1);
+                std::unique_lock<std::mutex> _lock(mutex);
+                signets.insert(signet);
+            });
+        }
+        pool.join(group);
+    });
+    pool.join();
+    TS_LOG_CHECKING(count.load() == 64);
+    TS_LOG_CHECKING(signets.size() > 1);
+}
+
+void test_full_deque() {
+    ThreadPool pool(2);
+    std::atomic<int> count(0);
+    // more tasks than deque capacity, the rest run inline in pushing thread
+    pool.run([&](int) {
+        ThreadPool::Group group;
+        for (int i = 0; i < 5000; ++i) {
+            pool.run(group, [&](int) { count.fetch_add(1); });
+        }
+        pool.join(group);
+    });
+    pool.join();
+    TS_LOG_CHECKING(count.load() == 5000);
+}
+
+void test_exception() {
+    ThreadPool pool(4);
+    for (int i = 0; i < 16; ++i) {
+        pool.run([i](int) { if (i == 7) throw std::logic_error("task failed"); });
+    }
+    bool caught = false;
+    try {
+        pool.join();
+    } catch (const std::logic_error &) {
+        caught = true;
+    }
+    TS_LOG_CHECKING(caught);
+    // exception is reported once
+    pool.run([](int) {});
+    pool.join();
+    TS_LOG_CHECKING(!pool.busy());
+}
+
+void test_foreign_threads() {
+    ThreadPool pool(4);
+    std::atomic<int> count(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 16; ++t) {
+        threads.emplace_back([&]() {
+            for (int round = 0; round < 50; ++round) {
+                for (int i = 0; i < 8; ++i) pool.run([&](int) { count.fetch_add(1); });
+                pool.join();
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    TS_LOG_CHECKING(count.load() == 16 * 50 * 8);
+}
+
+void test_shutdown() {
+    std::atomic<int> count(0);
+    {
+        ThreadPool pool(4);
+        for (int i = 0; i < 1000; ++i) pool.run([&](int) { count.fetch_add(1); });
+        // no join, pool finishes queued tasks before threads exit
+    }
+    TS_LOG_CHECKING(count.load() == 1000);
+
+    // idle threads, blocking or spinning, wake up and exit
+    int rounds = 0;
+    for (; rounds < 100; ++rounds) {
+        ThreadPool pool(4);
+        pool.set_spin_wait_time(rounds % 2 ? 50 : 0);
+    }
+    TS_LOG_CHECKING(rounds == 100);
+}
+
+/**
+ * @return milliseconds of process cpu time, used in sleeping milliseconds in calling thread
+ */
+static double cpu_time_in_sleep(int milliseconds) {
+    auto begin = std::clock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    return double(std::clock() - begin) * 1000 / CLOCKS_PER_SEC;
+}
+
+void test_spin_wait() {
+    ThreadPool pool(4);
+    pool.set_spin_wait_time(-5);
+    TS_LOG_CHECKING(pool.get_spin_wait_time() == 0);
+
+    // results are same with threads spinning between tasks
+    pool.set_spin_wait_time(100);
+    TS_LOG_CHECKING(pool.get_spin_wait_time() == 100);
+    bool all_counted = true;
+    for (int round = 0; round < 20; ++round) {
+        std::atomic<int> count(0);
+        pool.run([&](int) { nested(pool, count, 4); });
+        pool.join();
+        if (count.load() != 341) all_counted = false;
+    }
+    TS_LOG_CHECKING(all_counted);
+
+    // blocking at once, idle threads take no cpu
+    pool.set_spin_wait_time(0);
+    for (int i = 0; i < 4; ++i) pool.run([](int) {});
+    pool.join();
+    auto blocking = cpu_time_in_sleep(50);
+    TS_LOG_INFO << "Idle cpu time without spinning: " << blocking << "ms";
+    TS_LOG_CHECKING(blocking < 20);
+
+    // spinning threads keep busy until spin time out, then block
+    pool.set_spin_wait_time(200000);
+    for (int i = 0; i < 4; ++i) pool.run([](int) {});
+    pool.join();
+    auto spinning = cpu_time_in_sleep(50);
+    TS_LOG_INFO << "Idle cpu time while spinning: " << spinning << "ms";
+    TS_LOG_CHECKING(spinning > 25);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    auto timeout = cpu_time_in_sleep(50);
+    TS_LOG_INFO << "Idle cpu time after spinning: " << timeout << "ms";
+    TS_LOG_CHECKING(timeout < 20);
+}
+
+int main() {
+    test_nesting();
+    test_stealing();
+    test_full_deque();
+    test_exception();
+    test_foreign_threads();
+    test_shutdown();
+    test_spin_wait();
+
+    return 0;
+}
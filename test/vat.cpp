@@ -0,0 +1,170 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <memory/flow.h>
+#include <memory/planner.h>
+#include <runtime/workbench.h>
+
+#include <utils/log.h>
+
+#include <cmath>
+#include <set>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * @return capacity of size class, 4 classes each power of two, at least 64 bytes
+ */
+static size_t expected_capacity(size_t size) {
+    if (size <= 64) return 64;
+    int p = 0;
+    while ((size_t(2) << p) < size) ++p;
+    // 2^p < size <= 2^(p+1)
+    auto step = size_t(1) << (p - 2);
+    return (size + step - 1) / step * step;
+}
+
+/**
+ * @return capacity held for one living memory of size, by new controller, so no free block of other class reused
+ */
+static size_t capacity(size_t size) {
+    VatMemoryController controller(MemoryDevice(CPU, 0));
+    auto memory = controller.alloc(size);
+    return size_t(controller.statistics().used_capacity);
+}
+
+static bool check_capacity(size_t size) {
+    auto got = capacity(size);
+    if (got != expected_capacity(size)) {
+        TS_LOG_INFO << "size " << size << " in class of " << got << ", expected " << expected_capacity(size);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @return true if every size in [1, 4096] fits its class, and each power of two range has 4 classes
+ */
+static bool check_classes() {
+    std::set<size_t> classes;
+    for (size_t size = 1; size <= 4096; ++size) {
+        auto got = capacity(size);
+        if (got < size || (size > 64 && got - size >= size / 4)) {
+            TS_LOG_INFO << "size " << size << " in class of " << got;
+            return false;
+        }
+        classes.insert(got);
+    }
+    // 64, then 4 classes each of (64, 128], ..., (2048, 4096]
+    return classes.size() == 1 + 4 * 6;
+}
+
+static bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+
+int main() {
+    MemoryDevice device(CPU, 0);
+
+    TS_LOG_CHECKING(check_capacity(1));
+    TS_LOG_CHECKING(check_capacity(64));
+    TS_LOG_CHECKING(check_capacity(65));
+    TS_LOG_CHECKING(check_capacity(80));
+    TS_LOG_CHECKING(check_capacity(81));
+    TS_LOG_CHECKING(check_capacity(128));
+    TS_LOG_CHECKING(check_capacity(129));
+    TS_LOG_CHECKING(check_capacity(1023));
+    TS_LOG_CHECKING(check_capacity(1025));
+    TS_LOG_CHECKING(check_capacity((1 << 20) + 1));
+    TS_LOG_CHECKING(capacity(1025) == 1280);
+    TS_LOG_CHECKING(check_classes());
+
+    {
+        VatMemoryController controller(device);
+        auto statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 0 && statistics.free_blocks == 0);
+        TS_LOG_CHECKING(near(statistics.internal_fragmentation(), 0) && near(statistics.external_fragmentation(), 0));
+
+        // freed block is reused by size in same class
+        auto a = controller.alloc(100);
+        auto a_data = a.data();
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_size == 100 && statistics.used_capacity == 112 && statistics.used_blocks == 1);
+        a = Memory();
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 0 && statistics.free_blocks == 1 && statistics.free_capacity == 112);
+        TS_LOG_CHECKING(near(statistics.external_fragmentation(), 1));
+        auto b = controller.alloc(110);
+        TS_LOG_CHECKING(b.data() == a_data);
+        TS_LOG_CHECKING(controller.statistics().free_blocks == 0);
+        b = Memory();
+
+        // smaller size takes free block of larger class
+        auto c = controller.alloc(90);
+        TS_LOG_CHECKING(c.data() == a_data);
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_capacity == 112);
+        TS_LOG_CHECKING(near(statistics.internal_fragmentation(), 22.0 / 112));
+
+        // free blocks are reused last in first out
+        auto d = controller.alloc(100);
+        auto d_data = d.data();
+        TS_LOG_CHECKING(d_data != a_data);
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 2 && statistics.used_capacity == 224);
+        c = Memory();
+        d = Memory();
+        auto e = controller.alloc(100);
+        TS_LOG_CHECKING(e.data() == d_data);
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(near(statistics.external_fragmentation(), 0.5));
+
+        // no free block fits, the largest smaller one is grown, count of blocks kept
+        auto f = controller.alloc(500);
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 2 && statistics.free_blocks == 0);
+        TS_LOG_CHECKING(statistics.used_capacity == 112 + 512);
+        TS_LOG_CHECKING(controller.summary() == statistics.used_capacity + statistics.free_capacity);
+    }
+
+    {
+        LockedVatMemoryController controller(device);
+        auto a = controller.alloc(1000);
+        a = Memory();
+        auto statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.free_blocks == 1 && statistics.free_capacity == 1024);
+    }
+
+    {
+        // arena counted as one block
+        PlannedMemoryController controller(device);
+        controller.record();
+        controller.alloc(100);
+        controller.alloc(200);
+        auto plan = controller.finish();
+        // block of 100 bytes is freed, then grown for 200 bytes
+        auto statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 0 && statistics.free_blocks == 1);
+        controller.replay(plan);
+        auto a = controller.alloc(100);
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 1 && statistics.used_capacity == plan->arena_size());
+        a = Memory();
+        controller.finish();
+        statistics = controller.statistics();
+        TS_LOG_CHECKING(statistics.used_blocks == 0 && statistics.free_blocks == 2);
+    }
+
+    {
+        Workbench bench(ComputingDevice(CPU, 0));
+        auto summary = bench.summary();
+        TS_LOG_INFO << summary;
+        TS_LOG_CHECKING(summary.find("\"statistics\": {\"cpu:0\": {") != std::string::npos);
+        TS_LOG_CHECKING(summary.find("\"external_fragmentation\": ") != std::string::npos);
+    }
+
+    return 0;
+}
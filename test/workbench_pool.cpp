@@ -0,0 +1,177 @@
+//
+// Created by agent on 2026/10/17.
+//
+
+#include <module/module.h>
+#include <module/menu.h>
+#include <backend/name.h>
+#include <core/tensor_builder.h>
+#include <runtime/workbench.h>
+#include <runtime/workbench_pool.h>
+#include <utils/cpu.h>
+
+#include <utils/log.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <set>
+#include <thread>
+
+#define TS_LOG_CHECKING(condition) TS_LOG_INFO("Case [")((condition) ? "PASSED" : "FAILED")("]: ")(#condition)
+
+using namespace ts;
+
+/**
+ * y = sigmoid(x + 1)
+ */
+static Module::shared simple_module() {
+    Graph g;
+    ctx::bind<Graph> _bind_graph(g);
+    auto x = bubble::param("x");
+    auto one = bubble::data("one", tensor::from<float>(1.0f));
+    auto a = bubble::op("a", name::layer::add(), {x, one});
+    auto y = bubble::op("y", name::layer::sigmoid(), {a});
+    return Module::Load(g, {y});
+}
+
+static Tensor input(int seed) {
+    Tensor x(FLOAT32, {1, 3, 8, 8});
+    auto data = x.data<float>();
+    for (int i = 0; i < x.count(); ++i) data[i] = float((i * 5 + seed) % 11) / 11.0f - 0.5f;
+    return x;
+}
+
+/**
+ * @return if bench computes expected output of x
+ */
+static bool run_expected(Workbench &bench, const Tensor &x) {
+    bench.input(0, x);
+    bench.run();
+    auto &y = bench.output(0);
+    if (x.sizes() != y.sizes()) return false;
+    for (int i = 0; i < x.count(); ++i) {
+        auto want = 1.0f / (1.0f + std::exp(-(x.data<float>()[i] + 1.0f)));
+        if (std::fabs(want - y.data<float>()[i]) > 1e-5f) return false;
+    }
+    return true;
+}
+
+void test_checkout(Workbench::shared prototype) {
+    WorkbenchPool pool(prototype, 3);
+    TS_LOG_CHECKING(pool.size() == 3);
+    TS_LOG_CHECKING(pool.statistics().idle == 3);
+
+    std::set<Workbench *> benches;
+    {
+        auto a = pool.checkout();
+        auto b = pool.checkout();
+        auto c = pool.try_checkout();
+        TS_LOG_CHECKING(c != nullptr);
+        benches = {a.get(), b.get(), c.get()};
+        TS_LOG_CHECKING(benches.size() == 3);
+        // prototype is kept by caller
+        TS_LOG_CHECKING(benches.count(prototype.get()) == 0);
+        TS_LOG_CHECKING(pool.statistics().idle == 0);
+        TS_LOG_CHECKING(pool.try_checkout() == nullptr);
+    }
+    // all returned when released
+    auto statistics = pool.statistics();
+    TS_LOG_CHECKING(statistics.size == 3);
+    TS_LOG_CHECKING(statistics.idle == 3);
+    TS_LOG_CHECKING(statistics.checkouts == 3);
+    TS_LOG_CHECKING(statistics.waits == 0);
+
+    // returned workbenches are reused
+    auto again = pool.checkout();
+    TS_LOG_CHECKING(benches.count(again.get()) == 1);
+}
+
+void test_waiting(Workbench::shared prototype) {
+    WorkbenchPool pool(prototype, 1);
+    auto held = pool.checkout();
+    std::atomic<bool> got(false);
+    std::thread waiter([&]() {
+        auto bench = pool.checkout();
+        got = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TS_LOG_CHECKING(!got.load());
+    held.reset();
+    waiter.join();
+    TS_LOG_CHECKING(got.load());
+    auto statistics = pool.statistics();
+    TS_LOG_CHECKING(statistics.checkouts == 2);
+    TS_LOG_CHECKING(statistics.waits == 1);
+    TS_LOG_CHECKING(statistics.wait_time > 0);
+}
+
+void test_concurrent(Workbench::shared prototype) {
+    WorkbenchPool pool(prototype, 2);
+    std::atomic<bool> succeed(true);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 20; ++i) {
+                auto bench = pool.checkout();
+                if (!run_expected(*bench, input(t * 100 + i))) succeed = false;
+            }
+        });
+    }
+    // prototype runs at same time, never shared with pool
+    for (int i = 0; i < 20; ++i) {
+        if (!run_expected(*prototype, input(1000 + i))) succeed = false;
+    }
+    for (auto &thread : threads) thread.join();
+    TS_LOG_CHECKING(succeed.load());
+    TS_LOG_CHECKING(pool.statistics().checkouts == 80);
+}
+
+void test_outlive(Workbench::shared prototype) {
+    Workbench::shared bench;
+    {
+        WorkbenchPool pool(prototype, 2);
+        bench = pool.checkout();
+    }
+    // checked out workbench still usable after pool destroyed
+    TS_LOG_CHECKING(run_expected(*bench, input(7)));
+}
+
+void test_numa(Workbench::shared prototype) {
+    auto nodes = CpuEnable::get_numa_nodes();
+    if (nodes.empty()) {
+        TS_LOG_INFO << "No NUMA node found, skip NUMA cases";
+        return;
+    }
+    {
+        WorkbenchPool pool(prototype, 2, {nodes[0]}, true);
+        auto bench = pool.checkout();
+        TS_LOG_CHECKING(bench.get() != prototype.get());
+        TS_LOG_CHECKING(bench->runtime().get_numa_node() == nodes[0]);
+        TS_LOG_CHECKING(run_expected(*bench, input(3)));
+    }
+    // prototype is never placed
+    TS_LOG_CHECKING(prototype->runtime().get_numa_node() == -1);
+    TS_LOG_CHECKING(prototype->runtime().get_cpu_affinity().empty());
+
+    auto bench = prototype->clone();
+    bench->set_numa_node(nodes[0]);
+    TS_LOG_CHECKING(!bench->runtime().get_cpu_affinity().empty());
+    bench->set_numa_node(-1);
+    TS_LOG_CHECKING(bench->runtime().get_numa_node() == -1);
+    TS_LOG_CHECKING(bench->runtime().get_cpu_affinity().empty());
+    TS_LOG_CHECKING(run_expected(*bench, input(4)));
+}
+
+int main() {
+    auto prototype = std::make_shared<Workbench>(ComputingDevice(CPU));
+    prototype->setup(prototype->compile(simple_module()));
+
+    test_checkout(prototype);
+    test_waiting(prototype);
+    test_concurrent(prototype);
+    test_outlive(prototype);
+    test_numa(prototype);
+
+    return 0;
+}